@@ -0,0 +1,72 @@
+#ifndef SRC_CONTAINERSTATS_H_
+#define SRC_CONTAINERSTATS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+
+namespace s21 {
+/*  what one container did since it was created. the counters are only
+ * kept when S21_CONTAINER_STATS is defined (make STATS=1), otherwise
+ * stats() is all zeros and the containers carry no extra members  */
+struct container_stats {
+    std::size_t allocations = 0;
+    std::size_t reallocations = 0;
+    std::size_t copies = 0;
+    std::size_t comparisons = 0;
+    std::size_t rotations = 0;
+
+    container_stats operator-(container_stats const &before) const {
+        container_stats delta;
+        delta.allocations = allocations - before.allocations;
+        delta.reallocations = reallocations - before.reallocations;
+        delta.copies = copies - before.copies;
+        delta.comparisons = comparisons - before.comparisons;
+        delta.rotations = rotations - before.rotations;
+        return delta;
+    }
+};
+
+inline void dump(std::ostream &out, char const *name, container_stats const &stats) {
+    out << name << ": allocations=" << stats.allocations << " reallocations=" << stats.reallocations
+        << " copies=" << stats.copies << " comparisons=" << stats.comparisons
+        << " rotations=" << stats.rotations << '\n';
+}
+
+#ifdef S21_CONTAINER_STATS
+/*  relaxed atomics because the parallel set algebra of RBTree compares and
+ * rotates on several threads at once. a copied or moved container starts
+ * counting from zero  */
+struct _Stats_counters {
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> reallocations{0};
+    std::atomic<std::size_t> copies{0};
+    std::atomic<std::size_t> comparisons{0};
+    std::atomic<std::size_t> rotations{0};
+
+    _Stats_counters() {}
+    _Stats_counters(_Stats_counters const &) {}
+    _Stats_counters &operator=(_Stats_counters const &) { return *this; }
+
+    container_stats snapshot() const {
+        container_stats stats;
+        stats.allocations = allocations.load(std::memory_order_relaxed);
+        stats.reallocations = reallocations.load(std::memory_order_relaxed);
+        stats.copies = copies.load(std::memory_order_relaxed);
+        stats.comparisons = comparisons.load(std::memory_order_relaxed);
+        stats.rotations = rotations.load(std::memory_order_relaxed);
+        return stats;
+    }
+};
+
+#define S21_STATS_COUNTERS mutable s21::_Stats_counters _stats;
+#define S21_STATS_ADD(counter, n) _stats.counter.fetch_add((n), std::memory_order_relaxed)
+#define S21_STATS_SNAPSHOT() _stats.snapshot()
+#else
+#define S21_STATS_COUNTERS
+#define S21_STATS_ADD(counter, n) ((void)0)
+#define S21_STATS_SNAPSHOT() s21::container_stats()
+#endif
+}  // namespace s21
+
+#endif  // SRC_CONTAINERSTATS_H_
@@ -0,0 +1,227 @@
+#ifndef SRC_EPOCHRECLAMATION_H_
+#define SRC_EPOCHRECLAMATION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace s21 {
+/*  epoch-based reclamation shared by the concurrent containers.
+ * a reader pins the current global epoch for the length of a guard and
+ * announces it in its own slot with a plain store and a fence, so readers
+ * never write a shared cache line. an unlinked object is retired with the
+ * epoch of its removal and freed once the global epoch has moved two steps
+ * past it, which is only possible when every pinned reader has seen the
+ * removal. scheme described here: https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf */
+class EpochReclamation {
+ public:
+    using size_type = std::size_t;
+
+    /*  guards nest, a copy pins the same thread once more, so an iterator
+     * can carry one and stay valid for as long as it lives  */
+    class guard {
+     public:
+        guard() { _enter(); }
+        guard(const guard &) { _enter(); }
+        ~guard() { _leave(); }
+        guard &operator=(const guard &) { return *this; }
+    };
+
+    template <typename T>
+    static void retire(T *object) {
+        retire(static_cast<void *>(object), [](void *p) { delete static_cast<T *>(p); });
+    }
+    static void retire(void *object, void (*deleter)(void *));
+    static void reclaim();
+
+ private:
+    static std::uint64_t const _quiescent = ~std::uint64_t(0);
+    static size_type const _reclaim_threshold = 64;
+
+    struct _Retired {
+        void *object;
+        void (*deleter)(void *);
+        std::uint64_t epoch;
+        _Retired *next;
+    };
+
+    /*  one slot per thread, padded so that readers on different cores never
+     * share a line. slots of finished threads are handed to new ones  */
+    struct alignas(64) _Record {
+        std::atomic<std::uint64_t> epoch;
+        std::atomic<bool> in_use;
+        _Record *next;
+        size_type nesting;
+        _Retired *retired;
+        size_type retired_count;
+        size_type reclaim_at;
+
+        _Record()
+            : epoch(_quiescent), in_use(true), next(nullptr), nesting(0), retired(nullptr), retired_count(0),
+              reclaim_at(_reclaim_threshold) {}
+    };
+
+    struct _Domain {
+        alignas(64) std::atomic<std::uint64_t> epoch;
+        std::atomic<_Record *> records;
+        std::mutex orphans_mutex;
+        _Retired *orphans;
+
+        _Domain() : epoch(0), records(nullptr), orphans(nullptr) {}
+        ~_Domain();
+    };
+
+    struct _Thread {
+        _Record *record;
+
+        _Thread() : record(nullptr) {}
+        ~_Thread();
+    };
+
+    static _Domain &_domain();
+    static _Record *_local();
+    static void _enter();
+    static void _leave();
+    static std::uint64_t _try_advance(_Domain &domain);
+    static _Retired *_free_expired(_Retired *list, std::uint64_t epoch, size_type &count);
+};
+
+inline EpochReclamation::_Domain &EpochReclamation::_domain() {
+    static _Domain domain;
+    return domain;
+}
+
+inline EpochReclamation::_Domain::~_Domain() {
+    size_type count = 0;
+    _free_expired(orphans, _quiescent, count);
+    for (_Record *record = records.load(); record != nullptr;) {
+        _Record *next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+inline EpochReclamation::_Thread::~_Thread() {
+    if (record != nullptr) {
+        _Domain &domain = _domain();
+        if (record->retired != nullptr) {
+            std::lock_guard<std::mutex> lock(domain.orphans_mutex);
+            _Retired *last = record->retired;
+            while (last->next != nullptr) {
+                last = last->next;
+            }
+            last->next = domain.orphans;
+            domain.orphans = record->retired;
+        }
+        record->retired = nullptr;
+        record->retired_count = 0;
+        record->reclaim_at = _reclaim_threshold;
+        record->epoch.store(_quiescent, std::memory_order_release);
+        record->in_use.store(false, std::memory_order_release);
+    }
+}
+
+inline EpochReclamation::_Record *EpochReclamation::_local() {
+    static thread_local _Thread thread;
+    if (thread.record == nullptr) {
+        _Domain &domain = _domain();
+        for (_Record *record = domain.records.load(std::memory_order_acquire); record != nullptr;
+             record = record->next) {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed) &&
+                record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                thread.record = record;
+                break;
+            }
+        }
+        if (thread.record == nullptr) {
+            _Record *record = new _Record();
+            record->next = domain.records.load(std::memory_order_relaxed);
+            while (!domain.records.compare_exchange_weak(record->next, record, std::memory_order_release,
+                                                         std::memory_order_relaxed)) {
+            }
+            thread.record = record;
+        }
+    }
+    return thread.record;
+}
+
+inline void EpochReclamation::_enter() {
+    _Record *record = _local();
+    if (record->nesting++ == 0) {
+        record->epoch.store(_domain().epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+inline void EpochReclamation::_leave() {
+    _Record *record = _local();
+    if (--record->nesting == 0) {
+        record->epoch.store(_quiescent, std::memory_order_release);
+    }
+}
+
+inline void EpochReclamation::retire(void *object, void (*deleter)(void *)) {
+    _Record *record = _local();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::uint64_t epoch = _domain().epoch.load(std::memory_order_relaxed);
+    record->retired = new _Retired{object, deleter, epoch, record->retired};
+    if (++record->retired_count >= record->reclaim_at) {
+        reclaim();
+    }
+}
+
+inline void EpochReclamation::reclaim() {
+    _Domain &domain = _domain();
+    _Record *record = _local();
+    std::uint64_t epoch = _try_advance(domain);
+    size_type count = record->retired_count;
+    record->retired = _free_expired(record->retired, epoch, count);
+    record->retired_count = count;
+    /*  a reader stalled inside a guard holds the epoch back, scanning the
+     * whole list on every retire meanwhile would cost quadratic time  */
+    record->reclaim_at = (2 * count > _reclaim_threshold) ? 2 * count : _reclaim_threshold;
+    std::unique_lock<std::mutex> lock(domain.orphans_mutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+        size_type orphans = 0;
+        domain.orphans = _free_expired(domain.orphans, epoch, orphans);
+    }
+}
+
+inline std::uint64_t EpochReclamation::_try_advance(_Domain &domain) {
+    std::uint64_t epoch = domain.epoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (_Record *record = domain.records.load(std::memory_order_acquire); record != nullptr;
+         record = record->next) {
+        std::uint64_t pinned = record->epoch.load(std::memory_order_relaxed);
+        if (pinned != _quiescent && pinned != epoch) {
+            return epoch;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (domain.epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst)) {
+        ++epoch;
+    }
+    return epoch;
+}
+
+inline EpochReclamation::_Retired *EpochReclamation::_free_expired(_Retired *list, std::uint64_t epoch,
+                                                                   size_type &count) {
+    _Retired *kept = nullptr;
+    while (list != nullptr) {
+        _Retired *next = list->next;
+        if (epoch == _quiescent || epoch - list->epoch >= 2) {
+            list->deleter(list->object);
+            delete list;
+            --count;
+        } else {
+            list->next = kept;
+            kept = list;
+        }
+        list = next;
+    }
+    return kept;
+}
+}  // namespace s21
+
+#endif  // SRC_EPOCHRECLAMATION_H_
@@ -0,0 +1,270 @@
+#ifndef SRC_FORKJOINPOOL_H_
+#define SRC_FORKJOINPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "WorkStealingDeque.h"
+#include "s21_mpmc_queue.h"
+
+namespace s21 {
+/*  fork-join thread pool for the parallel algorithms of the library.
+ * invoke(left, right) forks right, runs left on the calling thread and then
+ * joins right. every worker keeps its forked tasks in its own
+ * WorkStealingDeque and pops the newest one back, idle workers steal the
+ * oldest task of a random victim, which is the biggest piece of work left.
+ * tasks forked by threads outside the pool go through a shared queue.
+ * a joining thread never blocks, it runs other tasks until its own one is
+ * done, so nested invoke() calls cannot starve the pool. idle workers spin,
+ * then yield, then sleep until new work is forked  */
+class ForkJoinPool {
+ public:
+    using size_type = std::size_t;
+
+    explicit ForkJoinPool(size_type threads = 0);
+    ForkJoinPool(const ForkJoinPool &p) = delete;
+    ~ForkJoinPool();
+    ForkJoinPool &operator=(const ForkJoinPool &p) = delete;
+
+    /*  pool with one worker per hardware thread, shared by the library  */
+    static ForkJoinPool &instance();
+
+    size_type size() const noexcept;
+
+    /*  runs both callables, possibly in parallel, and returns when both are
+     * done. an exception thrown by either one is rethrown here  */
+    template <typename Left, typename Right>
+    void invoke(Left &&left, Right &&right);
+
+ private:
+    static int const _spins = 64;
+    static int const _yields = 16;
+    static size_type const _injected_capacity = 1024;
+
+    struct _Task {
+        std::atomic<bool> done;
+        std::exception_ptr error;
+
+        _Task() : done(false) {}
+        virtual ~_Task() {}
+        virtual void execute() = 0;
+        void run();
+    };
+
+    template <typename Func>
+    struct _Closure : _Task {
+        Func &func;
+
+        explicit _Closure(Func &f) : func(f) {}
+        void execute() override { func(); }
+    };
+
+    struct alignas(64) _Worker {
+        ForkJoinPool *pool;
+        WorkStealingDeque<_Task *> tasks;
+        std::uint64_t seed;
+        std::thread thread;
+
+        _Worker(ForkJoinPool *p, std::uint64_t s) : pool(p), tasks(), seed(s), thread() {}
+    };
+
+    std::vector<std::unique_ptr<_Worker>> _workers;
+    mpmc_queue<_Task *> _injected;
+
+    std::mutex _park;
+    std::condition_variable _wakeup;
+    std::atomic<size_type> _sleeping;
+    std::atomic<bool> _stop;
+
+    static _Worker *&_current();
+    _Worker *_self();
+    void _work(_Worker &self);
+    _Task *_find_task(_Worker *self);
+    void _join(_Worker *self, _Task &task);
+    bool _has_work();
+    void _sleep();
+    void _notify();
+};
+
+inline void ForkJoinPool::_Task::run() {
+    try {
+        execute();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    /*  the joining thread may destroy the task as soon as it sees done  */
+    done.store(true, std::memory_order_release);
+}
+
+inline ForkJoinPool::ForkJoinPool(size_type threads)
+    : _injected(_injected_capacity), _sleeping(0), _stop(false) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+    for (size_type i = 0; i < threads; ++i) {
+        _workers.emplace_back(new _Worker(this, 0x9e3779b97f4a7c15ull * (i + 1)));
+    }
+    for (auto &worker : _workers) {
+        _Worker *self = worker.get();
+        self->thread = std::thread([this, self]() { _work(*self); });
+    }
+}
+
+inline ForkJoinPool::~ForkJoinPool() {
+    _stop.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(_park);
+        _wakeup.notify_all();
+    }
+    for (auto &worker : _workers) {
+        worker->thread.join();
+    }
+}
+
+inline ForkJoinPool &ForkJoinPool::instance() {
+    static ForkJoinPool pool;
+    return pool;
+}
+
+inline ForkJoinPool::size_type ForkJoinPool::size() const noexcept {
+    return _workers.size();
+}
+
+template <typename Left, typename Right>
+void ForkJoinPool::invoke(Left &&left, Right &&right) {
+    _Closure<typename std::remove_reference<Right>::type> forked(right);
+    _Worker *self = _self();
+    if (self != nullptr) {
+        self->tasks.push(&forked);
+    } else if (!_injected.try_push(&forked)) {
+        forked.run();
+    }
+    _notify();
+    std::exception_ptr error;
+    try {
+        left();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    _join(self, forked);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    if (forked.error) {
+        std::rethrow_exception(forked.error);
+    }
+}
+
+inline ForkJoinPool::_Worker *&ForkJoinPool::_current() {
+    static thread_local _Worker *worker = nullptr;
+    return worker;
+}
+
+inline ForkJoinPool::_Worker *ForkJoinPool::_self() {
+    _Worker *worker = _current();
+    return (worker != nullptr && worker->pool == this) ? worker : nullptr;
+}
+
+inline void ForkJoinPool::_work(_Worker &self) {
+    _current() = &self;
+    int idle = 0;
+    while (!_stop.load(std::memory_order_acquire)) {
+        _Task *task = _find_task(&self);
+        if (task != nullptr) {
+            task->run();
+            idle = 0;
+        } else if (idle < _spins) {
+            ++idle;
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        } else if (idle < _spins + _yields) {
+            ++idle;
+            std::this_thread::yield();
+        } else {
+            _sleep();
+            idle = 0;
+        }
+    }
+    _current() = nullptr;
+}
+
+inline ForkJoinPool::_Task *ForkJoinPool::_find_task(_Worker *self) {
+    _Task *task = nullptr;
+    if (self != nullptr && self->tasks.pop(task)) {
+        return task;
+    }
+    size_type count = _workers.size();
+    size_type start = 0;
+    if (self != nullptr) {
+        self->seed ^= self->seed << 13;
+        self->seed ^= self->seed >> 7;
+        self->seed ^= self->seed << 17;
+        start = static_cast<size_type>(self->seed % count);
+    }
+    for (size_type i = 0; i < count; ++i) {
+        _Worker *victim = _workers[(start + i) % count].get();
+        if (victim != self && victim->tasks.steal(task)) {
+            return task;
+        }
+    }
+    if (_injected.try_pop(task)) {
+        return task;
+    }
+    return nullptr;
+}
+
+inline void ForkJoinPool::_join(_Worker *self, _Task &task) {
+    /*  the forked task is usually still on top of our own deque and gets
+     * popped back first, otherwise help whoever stole it  */
+    while (!task.done.load(std::memory_order_acquire)) {
+        _Task *other = _find_task(self);
+        if (other != nullptr) {
+            other->run();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+inline bool ForkJoinPool::_has_work() {
+    for (auto &worker : _workers) {
+        if (!worker->tasks.empty()) {
+            return true;
+        }
+    }
+    return !_injected.empty();
+}
+
+inline void ForkJoinPool::_sleep() {
+    std::unique_lock<std::mutex> lock(_park);
+    _sleeping.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!_stop.load(std::memory_order_acquire) && !_has_work()) {
+        _wakeup.wait(lock);
+    }
+    _sleeping.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void ForkJoinPool::_notify() {
+    /*  pairs with the fence in _sleep(), either the sleeper sees the new
+     * task or this thread sees the sleeper  */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(_park);
+        _wakeup.notify_one();
+    }
+}
+}  // namespace s21
+
+#endif  // SRC_FORKJOINPOOL_H_
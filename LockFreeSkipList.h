@@ -0,0 +1,444 @@
+#ifndef SRC_LOCKFREESKIPLIST_H_
+#define SRC_LOCKFREESKIPLIST_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "EpochReclamation.h"
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  lock-free skip list of unique keys.
+ * every link carries a mark in its lowest bit, a node is removed by marking
+ * its own links from the top level down, the thread that marks the bottom
+ * link owns the removal. searches unlink the marked nodes they pass, and
+ * unlinked nodes go to EpochReclamation.
+ * algorithm described here: Herlihy, Shavit "The Art of Multiprocessor
+ * Programming", 14.4, and https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf */
+template <class T, typename _Cmp = std::less<T>>
+class LockFreeSkipList {
+ private:
+    struct _Node;
+    struct _LockFreeSkipList_iterator;
+
+ public:
+    using key_type = T;
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using iterator = _LockFreeSkipList_iterator;
+    using const_iterator = _LockFreeSkipList_iterator;
+    using size_type = std::size_t;
+
+    explicit LockFreeSkipList(double level_probability = 0.25);
+    LockFreeSkipList(const LockFreeSkipList &m) = delete;
+    ~LockFreeSkipList();
+    LockFreeSkipList &operator=(const LockFreeSkipList &m) = delete;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    double level_probability() const noexcept;
+    /*  a walk of the bottom level, approximate while other threads insert
+     * and erase  */
+    memory_footprint memory_usage() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    void clear();
+    std::pair<iterator, bool> insert(const value_type &value);
+    size_type erase(const key_type &key);
+
+    const_iterator find(const key_type &key) const;
+    bool contains(const key_type &key) const;
+    const_iterator lower_bound(const key_type &key) const;
+    const_iterator upper_bound(const key_type &key) const;
+
+ private:
+    using _link = std::atomic<std::uintptr_t>;
+
+    static size_type const _max_level = 32;
+
+    /*  _head holds the first link of every level, a _Node is followed in
+     * memory by its top links  */
+    _link _head[_max_level];
+    std::atomic<size_type> _size;
+    std::uint32_t _threshold;
+
+    struct _Node {
+        value_type data;
+        size_type top;
+        /*  the inserter still linking the upper levels and the remover both
+         * hold the node, the last one to let go unlinks it for good and
+         * retires it  */
+        std::atomic<int> owners;
+
+        _Node(const_reference _data, size_type _top) : data(_data), top(_top), owners(2) {}
+        _link *next() noexcept { return reinterpret_cast<_link *>(this + 1); }
+        _link const *next() const noexcept { return reinterpret_cast<_link const *>(this + 1); }
+    };
+
+    static bool _less(const_reference a, const_reference b) { return _Cmp{}(a, b); }
+    static _Node *_ptr(std::uintptr_t link) { return reinterpret_cast<_Node *>(link & ~std::uintptr_t(1)); }
+    static bool _marked(std::uintptr_t link) { return (link & 1) != 0; }
+    static std::uintptr_t _bits(_Node *node) { return reinterpret_cast<std::uintptr_t>(node); }
+
+    static _Node *_create(const_reference value, size_type top);
+    static void _destroy(void *node);
+    size_type _random_level() const;
+    bool _find(const key_type &key, _link **preds, _Node **succs);
+    _Node *_search(const key_type &key) const;
+    void _release(_Node *node);
+
+    struct _LockFreeSkipList_iterator {
+        using _self = _LockFreeSkipList_iterator;
+
+        /*  walks the bottom level and skips removed nodes, the guard keeps
+         * every node it can reach alive. it must stay on the thread that
+         * created it  */
+        _Node const *node;
+        EpochReclamation::guard guard;
+
+        explicit _LockFreeSkipList_iterator(_Node const *_node) noexcept : node(_node) { skip_marked(); }
+
+        const_reference operator*() const noexcept { return node->data; }
+        value_type const *operator->() const noexcept { return &node->data; }
+
+        _self &operator++() noexcept {
+            node = _ptr(node->next()[0].load(std::memory_order_acquire));
+            skip_marked();
+            return *this;
+        }
+
+        _self operator++(int) noexcept {
+            _self it = *this;
+            ++(*this);
+            return it;
+        }
+
+        bool operator==(_self const &other) const noexcept { return node == other.node; }
+        bool operator!=(_self const &other) const noexcept { return node != other.node; }
+
+        void skip_marked() noexcept {
+            while (node != nullptr) {
+                std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+                if (!_marked(next)) {
+                    break;
+                }
+                node = _ptr(next);
+            }
+        }
+    };
+};
+
+template <class T, typename _Cmp>
+LockFreeSkipList<T, _Cmp>::LockFreeSkipList(double level_probability) : _size(0), _threshold(0) {
+    if (level_probability < 0.0) {
+        level_probability = 0.0;
+    } else if (level_probability > 0.875) {
+        level_probability = 0.875;
+    }
+    _threshold = static_cast<std::uint32_t>(level_probability * 4294967296.0);
+    for (size_type level = 0; level < _max_level; ++level) {
+        _head[level].store(0, std::memory_order_relaxed);
+    }
+}
+
+template <class T, typename _Cmp>
+LockFreeSkipList<T, _Cmp>::~LockFreeSkipList() {
+    /*  nobody else may use the list any more, every removal has finished and
+     * the bottom level holds exactly the live nodes  */
+    _Node *node = _ptr(_head[0].load(std::memory_order_acquire));
+    while (node != nullptr) {
+        _Node *next = _ptr(node->next()[0].load(std::memory_order_relaxed));
+        _destroy(node);
+        node = next;
+    }
+}
+
+template <class T, typename _Cmp>
+bool LockFreeSkipList<T, _Cmp>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::size_type LockFreeSkipList<T, _Cmp>::size() const noexcept {
+    return _size.load(std::memory_order_relaxed);
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::size_type LockFreeSkipList<T, _Cmp>::max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / (sizeof(_Node) + sizeof(_link));
+}
+
+template <class T, typename _Cmp>
+double LockFreeSkipList<T, _Cmp>::level_probability() const noexcept {
+    return static_cast<double>(_threshold) / 4294967296.0;
+}
+
+template <class T, typename _Cmp>
+memory_footprint LockFreeSkipList<T, _Cmp>::memory_usage() const {
+    EpochReclamation::guard guard;
+    memory_footprint usage;
+    usage.metadata = sizeof(*this);
+    for (_Node *node = _ptr(_head[0].load(std::memory_order_acquire)); node != nullptr;
+         node = _ptr(node->next()[0].load(std::memory_order_acquire))) {
+        size_type bytes = sizeof(_Node) + node->top * sizeof(_link);
+        usage.payload += sizeof(T);
+        usage.metadata += bytes - sizeof(T);
+        usage.overhead += heap_block_overhead(bytes);
+    }
+    return usage;
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::const_iterator LockFreeSkipList<T, _Cmp>::begin() const {
+    EpochReclamation::guard guard;
+    return const_iterator(_ptr(_head[0].load(std::memory_order_acquire)));
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::const_iterator LockFreeSkipList<T, _Cmp>::end() const {
+    return const_iterator(nullptr);
+}
+
+template <class T, typename _Cmp>
+void LockFreeSkipList<T, _Cmp>::clear() {
+    for (auto it = begin(); it != end(); ++it) {
+        erase(*it);
+    }
+}
+
+template <class T, typename _Cmp>
+std::pair<typename LockFreeSkipList<T, _Cmp>::iterator, bool> LockFreeSkipList<T, _Cmp>::insert(
+    const value_type &value) {
+    EpochReclamation::guard guard;
+    _link *preds[_max_level];
+    _Node *succs[_max_level];
+    size_type top = _random_level();
+    _Node *node = nullptr;
+    while (node == nullptr) {
+        if (_find(value, preds, succs)) {
+            return std::make_pair(iterator(succs[0]), false);
+        }
+        node = _create(value, top);
+        for (size_type level = 0; level < top; ++level) {
+            node->next()[level].store(_bits(succs[level]), std::memory_order_relaxed);
+        }
+        std::uintptr_t expected = _bits(succs[0]);
+        if (!preds[0][0].compare_exchange_strong(expected, _bits(node), std::memory_order_acq_rel)) {
+            _destroy(node);
+            node = nullptr;
+        }
+    }
+    _size.fetch_add(1, std::memory_order_relaxed);
+    iterator result(node);
+
+    /*  the node is in the set once the bottom level links it, the upper
+     * levels are only shortcuts and linking them stops as soon as a remover
+     * starts marking the node  */
+    bool linking = true;
+    for (size_type level = 1; linking && level < top; ++level) {
+        while (linking) {
+            std::uintptr_t own = node->next()[level].load(std::memory_order_acquire);
+            if (_marked(own) || (own != _bits(succs[level]) &&
+                                 !node->next()[level].compare_exchange_strong(own, _bits(succs[level]),
+                                                                              std::memory_order_acq_rel))) {
+                linking = false;
+            } else {
+                std::uintptr_t expected = _bits(succs[level]);
+                if (preds[level][level].compare_exchange_strong(expected, _bits(node),
+                                                                std::memory_order_acq_rel)) {
+                    break;
+                }
+                _find(value, preds, succs);
+                linking = (succs[0] == node);
+            }
+        }
+    }
+    _release(node);
+    return std::make_pair(result, true);
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::size_type LockFreeSkipList<T, _Cmp>::erase(const key_type &key) {
+    EpochReclamation::guard guard;
+    _link *preds[_max_level];
+    _Node *succs[_max_level];
+    if (!_find(key, preds, succs)) {
+        return 0;
+    }
+    _Node *node = succs[0];
+    for (size_type level = node->top; level-- > 1;) {
+        std::uintptr_t next = node->next()[level].load(std::memory_order_acquire);
+        while (!_marked(next) &&
+               !node->next()[level].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel)) {
+        }
+    }
+    std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+    while (true) {
+        if (_marked(next)) {
+            return 0;
+        }
+        if (node->next()[0].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    _size.fetch_sub(1, std::memory_order_relaxed);
+    _find(key, preds, succs);
+    _release(node);
+    return 1;
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::const_iterator LockFreeSkipList<T, _Cmp>::find(
+    const key_type &key) const {
+    EpochReclamation::guard guard;
+    _Node *node = _search(key);
+    if (node != nullptr && _less(key, node->data)) {
+        node = nullptr;
+    }
+    return const_iterator(node);
+}
+
+template <class T, typename _Cmp>
+bool LockFreeSkipList<T, _Cmp>::contains(const key_type &key) const {
+    EpochReclamation::guard guard;
+    _Node *node = _search(key);
+    return node != nullptr && !_less(key, node->data);
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::const_iterator LockFreeSkipList<T, _Cmp>::lower_bound(
+    const key_type &key) const {
+    EpochReclamation::guard guard;
+    return const_iterator(_search(key));
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::const_iterator LockFreeSkipList<T, _Cmp>::upper_bound(
+    const key_type &key) const {
+    EpochReclamation::guard guard;
+    const_iterator it(_search(key));
+    if (it.node != nullptr && !_less(key, it.node->data)) {
+        ++it;
+    }
+    return it;
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::_Node *LockFreeSkipList<T, _Cmp>::_create(const_reference value,
+                                                                             size_type top) {
+    void *memory = ::operator new(sizeof(_Node) + top * sizeof(_link));
+    S21_TRACK_ALLOCATED("skip_list", sizeof(_Node) + top * sizeof(_link));
+    _Node *node = new (memory) _Node(value, top);
+    for (size_type level = 0; level < top; ++level) {
+        new (node->next() + level) _link(0);
+    }
+    return node;
+}
+
+template <class T, typename _Cmp>
+void LockFreeSkipList<T, _Cmp>::_destroy(void *memory) {
+    _Node *node = static_cast<_Node *>(memory);
+    for (size_type level = 0; level < node->top; ++level) {
+        node->next()[level].~_link();
+    }
+    S21_TRACK_RELEASED("skip_list", sizeof(_Node) + node->top * sizeof(_link));
+    node->~_Node();
+    ::operator delete(memory);
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::size_type LockFreeSkipList<T, _Cmp>::_random_level() const {
+    static thread_local std::uint64_t state =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ull | 1;
+    size_type level = 1;
+    while (level < _max_level) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        if (static_cast<std::uint32_t>(state >> 32) >= _threshold) {
+            break;
+        }
+        ++level;
+    }
+    return level;
+}
+
+template <class T, typename _Cmp>
+bool LockFreeSkipList<T, _Cmp>::_find(const key_type &key, _link **preds, _Node **succs) {
+    /*  records the last node before key and the first one after it on every
+     * level and unlinks the marked nodes in between, starting over whenever
+     * a predecessor turns out to be marked itself  */
+    bool restart = true;
+    while (restart) {
+        restart = false;
+        _link *pred = _head;
+        for (size_type level = _max_level; !restart && level-- > 0;) {
+            _Node *curr = _ptr(pred[level].load(std::memory_order_acquire));
+            while (curr != nullptr) {
+                std::uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+                if (_marked(succ)) {
+                    std::uintptr_t expected = _bits(curr);
+                    if (!pred[level].compare_exchange_strong(expected, succ & ~std::uintptr_t(1),
+                                                             std::memory_order_acq_rel)) {
+                        restart = true;
+                        break;
+                    }
+                    curr = _ptr(succ);
+                } else if (_less(curr->data, key)) {
+                    pred = curr->next();
+                    curr = _ptr(succ);
+                } else {
+                    break;
+                }
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+    }
+    return succs[0] != nullptr && !_less(key, succs[0]->data);
+}
+
+template <class T, typename _Cmp>
+typename LockFreeSkipList<T, _Cmp>::_Node *LockFreeSkipList<T, _Cmp>::_search(const key_type &key) const {
+    /*  read-only descent: marked nodes are walked through instead of being
+     * unlinked, their links still lead forward  */
+    _link const *pred = _head;
+    _Node *curr = nullptr;
+    for (size_type level = _max_level; level-- > 0;) {
+        curr = _ptr(pred[level].load(std::memory_order_acquire));
+        while (curr != nullptr && _less(curr->data, key)) {
+            pred = curr->next();
+            curr = _ptr(pred[level].load(std::memory_order_acquire));
+        }
+    }
+    while (curr != nullptr) {
+        std::uintptr_t next = curr->next()[0].load(std::memory_order_acquire);
+        if (!_marked(next)) {
+            break;
+        }
+        curr = _ptr(next);
+    }
+    return curr;
+}
+
+template <class T, typename _Cmp>
+void LockFreeSkipList<T, _Cmp>::_release(_Node *node) {
+    if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        _link *preds[_max_level];
+        _Node *succs[_max_level];
+        _find(node->data, preds, succs);
+        EpochReclamation::retire(node, &LockFreeSkipList::_destroy);
+    }
+}
+}  // namespace s21
+
+#endif  // SRC_LOCKFREESKIPLIST_H_
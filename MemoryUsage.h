@@ -0,0 +1,179 @@
+#ifndef SRC_MEMORYUSAGE_H_
+#define SRC_MEMORYUSAGE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+
+namespace s21 {
+/*  the bytes a container holds, as returned by memory_usage(). payload is
+ * the elements, metadata is the container object, node links, sentinels
+ * and index structures, slack is allocated room that holds no element,
+ * overhead is what malloc adds to every block. elements that own memory
+ * themselves count by sizeof only  */
+struct memory_footprint {
+    std::size_t payload = 0;
+    std::size_t metadata = 0;
+    std::size_t slack = 0;
+    std::size_t overhead = 0;
+
+    std::size_t total() const { return payload + metadata + slack + overhead; }
+
+    memory_footprint &operator+=(memory_footprint const &other) {
+        payload += other.payload;
+        metadata += other.metadata;
+        slack += other.slack;
+        overhead += other.overhead;
+        return *this;
+    }
+};
+
+inline void dump(std::ostream &out, char const *name, memory_footprint const &usage) {
+    out << name << ": payload=" << usage.payload << " metadata=" << usage.metadata << " slack=" << usage.slack
+        << " overhead=" << usage.overhead << " total=" << usage.total() << '\n';
+}
+
+/*  glibc malloc puts an 8 byte header in front of every block and rounds
+ * it up to 16 bytes, with 32 bytes at least  */
+inline std::size_t heap_block_overhead(std::size_t bytes) {
+    std::size_t chunk = (bytes + 8 + 15) & ~std::size_t(15);
+    return ((chunk < 32) ? 32 : chunk) - bytes;
+}
+
+/*  count heap nodes of node_bytes each, value_bytes of which are the
+ * element  */
+inline memory_footprint node_footprint(std::size_t count, std::size_t node_bytes, std::size_t value_bytes) {
+    memory_footprint usage;
+    usage.payload = count * value_bytes;
+    usage.metadata = count * (node_bytes - value_bytes);
+    usage.overhead = count * heap_block_overhead(node_bytes);
+    return usage;
+}
+
+/*  a single heap buffer of capacity slots, size of them in use  */
+inline memory_footprint buffer_footprint(std::size_t size, std::size_t capacity, std::size_t value_bytes) {
+    memory_footprint usage;
+    usage.payload = size * value_bytes;
+    usage.slack = (capacity - size) * value_bytes;
+    usage.overhead = heap_block_overhead(capacity * value_bytes);
+    return usage;
+}
+
+/*  live heap bytes and blocks of every container type in the process,
+ * gathered at the allocation sites when S21_MEMORY_TRACKING is defined
+ * (make TRACKING=1). the container types share a small fixed table keyed
+ * by name, so reporting an allocation takes no lock  */
+struct memory_tracker {
+    struct usage {
+        char const *name;
+        std::size_t bytes;
+        std::size_t blocks;
+        std::size_t peak_bytes;
+    };
+
+    static memory_tracker &instance() {
+        static memory_tracker tracker;
+        return tracker;
+    }
+
+    void allocated(char const *name, std::size_t bytes) {
+        _Entry &entry = _find(name);
+        std::size_t now = entry.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        entry.blocks.fetch_add(1, std::memory_order_relaxed);
+        std::size_t peak = entry.peak_bytes.load(std::memory_order_relaxed);
+        while (peak < now && !entry.peak_bytes.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+        }
+    }
+
+    void released(char const *name, std::size_t bytes) {
+        _Entry &entry = _find(name);
+        entry.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        entry.blocks.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /*  all zeros for a container type that never allocated  */
+    usage find(char const *name) const {
+        for (_Entry const &entry : _table) {
+            char const *current = entry.name.load(std::memory_order_acquire);
+            if (current != nullptr && std::strcmp(current, name) == 0) {
+                return _read(entry);
+            }
+        }
+        return usage{name, 0, 0, 0};
+    }
+
+    template <typename Func>
+    void for_each(Func func) const {
+        for (_Entry const &entry : _table) {
+            if (entry.name.load(std::memory_order_acquire) != nullptr) {
+                func(_read(entry));
+            }
+        }
+    }
+
+    void dump(std::ostream &out) const {
+        for_each([&out](usage const &u) {
+            out << u.name << ": bytes=" << u.bytes << " blocks=" << u.blocks << " peak_bytes=" << u.peak_bytes
+                << '\n';
+        });
+    }
+
+ private:
+    static std::size_t const _types = 32;
+
+    struct _Entry {
+        std::atomic<char const *> name{nullptr};
+        std::atomic<std::size_t> bytes{0};
+        std::atomic<std::size_t> blocks{0};
+        std::atomic<std::size_t> peak_bytes{0};
+    };
+
+    _Entry _table[_types];
+
+    memory_tracker() {}
+
+    static usage _read(_Entry const &entry) {
+        return usage{entry.name.load(std::memory_order_acquire), entry.bytes.load(std::memory_order_relaxed),
+                     entry.blocks.load(std::memory_order_relaxed),
+                     entry.peak_bytes.load(std::memory_order_relaxed)};
+    }
+
+    _Entry &_find(char const *name) {
+        /*  a type claims the first free entry, the last entry takes in every
+         * type that does not fit  */
+        for (_Entry &entry : _table) {
+            char const *current = entry.name.load(std::memory_order_acquire);
+            if (current == nullptr &&
+                entry.name.compare_exchange_strong(current, name, std::memory_order_acq_rel)) {
+                return entry;
+            }
+            if (current == name || std::strcmp(current, name) == 0) {
+                return entry;
+            }
+        }
+        return _table[_types - 1];
+    }
+};
+
+#ifdef S21_MEMORY_TRACKING
+#define S21_TRACK_ALLOCATED(name, bytes) s21::memory_tracker::instance().allocated((name), (bytes))
+#define S21_TRACK_RELEASED(name, bytes) s21::memory_tracker::instance().released((name), (bytes))
+/*  for node types that are created with new and destroyed with delete  */
+#define S21_TRACKED_NODE(name)                                   \
+    static void *operator new(std::size_t bytes) {               \
+        S21_TRACK_ALLOCATED(name, bytes);                        \
+        return ::operator new(bytes);                            \
+    }                                                            \
+    static void operator delete(void *node, std::size_t bytes) { \
+        S21_TRACK_RELEASED(name, bytes);                         \
+        ::operator delete(node);                                 \
+    }
+#else
+#define S21_TRACK_ALLOCATED(name, bytes) ((void)0)
+#define S21_TRACK_RELEASED(name, bytes) ((void)0)
+#define S21_TRACKED_NODE(name)
+#endif
+}  // namespace s21
+
+#endif  // SRC_MEMORYUSAGE_H_
@@ -0,0 +1,725 @@
+#ifndef SRC_PERSISTENTRBTREE_H_
+#define SRC_PERSISTENTRBTREE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+#define PRBNodeBlack 0
+#define PRBNodeRed 1
+
+namespace s21 {
+template <class T, typename _Cmp = std::less<T>>
+class PersistentRBTree {
+ private:
+    struct _Node;
+    struct _PersistentRBTree_iterator;
+
+ public:
+    using key_type = T;
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using iterator = _PersistentRBTree_iterator;
+    using const_iterator = _PersistentRBTree_iterator;
+    using size_type = std::size_t;
+
+    PersistentRBTree();
+    explicit PersistentRBTree(std::initializer_list<value_type> const &items);
+    template <typename InputIt>
+    PersistentRBTree(InputIt first, InputIt last);
+    PersistentRBTree(const PersistentRBTree &m);
+    PersistentRBTree(PersistentRBTree &&m);
+    ~PersistentRBTree();
+    PersistentRBTree &operator=(const PersistentRBTree &m);
+    PersistentRBTree &operator=(PersistentRBTree &&m);
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    /*  nodes shared with other versions count in each of them  */
+    memory_footprint memory_usage() const;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    PersistentRBTree insert(const value_type &value) const;
+    PersistentRBTree insert_or_assign(const value_type &value) const;
+    PersistentRBTree erase(const key_type &key) const;
+    void swap(PersistentRBTree &other) noexcept;
+
+    const_iterator find(const key_type &key) const;
+    bool contains(const key_type &key) const;
+    size_type count(const key_type &key) const;
+    const_iterator lower_bound(const key_type &key) const;
+    const_iterator upper_bound(const key_type &key) const;
+
+ private:
+    /*  nodes are never changed once another version can see them: an update
+     * copies the nodes on its search path and shares every other subtree with
+     * the version it started from. refs counts the parents and versions that
+     * point to a node, a node with refs == 1 belongs to the update in progress
+     * alone and is changed in place instead of being copied.
+     * every helper below that takes nodes releases them when it throws, so a
+     * failed update leaks nothing and never releases a node twice  */
+    _Node *_root;
+    size_type _size;
+
+    /*  a red-black tree of n nodes is at most 2 * log2(n + 1) high, so capping
+     * the size at 2^32 - 1 keeps every iterator path within 64 slots  */
+    static constexpr size_type _max_height = 64;
+    static constexpr size_type _max_nodes = (std::numeric_limits<size_type>::digits > _max_height / 2)
+                                            ? (size_type(1) << (_max_height / 2)) - 1
+                                            : std::numeric_limits<size_type>::max();
+
+    struct _Node {
+        value_type data;
+        _Node *left;
+        _Node *right;
+        std::atomic<size_type> refs;
+        std::uint8_t bh;
+        bool color;
+
+        S21_TRACKED_NODE("persistent_rbtree")
+
+        explicit _Node(const_reference _data)
+            : data(_data), left(nullptr), right(nullptr), refs(1), bh(0), color(PRBNodeRed) {}
+        _Node(_Node const &other)
+            : data(other.data),
+              left(_acquire(other.left)),
+              right(_acquire(other.right)),
+              refs(1),
+              bh(other.bh),
+              color(other.color) {}
+        bool is_red() const { return color == PRBNodeRed; }
+        bool is_black() const { return color == PRBNodeBlack; }
+    };
+
+    static bool _less(const_reference a, const_reference b) { return _Cmp{}(a, b); }
+    static bool _is_red(_Node const *node) { return node != nullptr && node->is_red(); }
+    static size_type _bh(_Node const *node) { return (node == nullptr) ? 0 : node->bh; }
+
+    static _Node *_acquire(_Node *node);
+    static void _release(_Node *node);
+    static _Node *_own(_Node *node);
+    static void _update(_Node *node);
+    static _Node *_blacken(_Node *node);
+    static _Node *_rotate_left(_Node *node);
+    static _Node *_rotate_right(_Node *node);
+    static _Node *_join(_Node *left, _Node *node, _Node *right);
+    static _Node *_join_right(_Node *left, _Node *node, _Node *right);
+    static _Node *_join_left(_Node *left, _Node *node, _Node *right);
+    static _Node *_split(_Node *node, const key_type &key, _Node *&left, _Node *&right);
+    static _Node *_split_last(_Node *node, _Node *&last);
+    static _Node *_concat(_Node *left, _Node *right);
+
+    void _put(const value_type &value, bool assign);
+    void _remove(const key_type &key);
+    const_iterator _bound(const key_type &key, bool upper) const;
+
+    struct _PersistentRBTree_iterator {
+        using _self = _PersistentRBTree_iterator;
+
+        /*  path from the root down to the current node, end() is the empty
+         * path. the root is kept to step back from end()  */
+        _Node const *root;
+        _Node const *path[_max_height];
+        size_type depth;
+
+        explicit _PersistentRBTree_iterator(_Node const *_root) noexcept
+            : root(_root), depth(0) {}
+
+        const_reference operator*() const noexcept { return path[depth - 1]->data; }
+        value_type const *operator->() const noexcept { return &path[depth - 1]->data; }
+
+        _self &operator++() noexcept {
+            _Node const *node = path[depth - 1];
+            if (node->right != nullptr) {
+                push_leftmost(node->right);
+            } else {
+                --depth;
+                while (depth > 0 && path[depth - 1]->right == node) {
+                    node = path[--depth];
+                }
+            }
+            return *this;
+        }
+
+        _self operator++(int) noexcept {
+            _self it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _self &operator--() noexcept {
+            if (depth == 0) {
+                push_rightmost(root);
+            } else if (path[depth - 1]->left != nullptr) {
+                push_rightmost(path[depth - 1]->left);
+            } else {
+                _Node const *node = path[--depth];
+                while (depth > 0 && path[depth - 1]->left == node) {
+                    node = path[--depth];
+                }
+            }
+            return *this;
+        }
+
+        _self operator--(int) noexcept {
+            _self it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_self const &other) const noexcept {
+            return depth == other.depth &&
+                   (depth == 0 || path[depth - 1] == other.path[depth - 1]);
+        }
+
+        bool operator!=(_self const &other) const noexcept { return !(*this == other); }
+
+        void push_leftmost(_Node const *node) noexcept {
+            for (; node != nullptr; node = node->left) {
+                path[depth++] = node;
+            }
+        }
+
+        void push_rightmost(_Node const *node) noexcept {
+            for (; node != nullptr; node = node->right) {
+                path[depth++] = node;
+            }
+        }
+    };
+};
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp>::PersistentRBTree() : _root(nullptr), _size(0) {}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp>::PersistentRBTree(std::initializer_list<value_type> const &items)
+    : PersistentRBTree(items.begin(), items.end()) {}
+
+template <class T, typename _Cmp>
+template <typename InputIt>
+PersistentRBTree<T, _Cmp>::PersistentRBTree(InputIt first, InputIt last)
+    : _root(nullptr), _size(0) {
+    /*  no other version shares these nodes yet, so every update below runs
+     * in place  */
+    for (; first != last; ++first) {
+        _put(*first, false);
+    }
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp>::PersistentRBTree(const PersistentRBTree &m)
+    : _root(_acquire(m._root)), _size(m._size) {}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp>::PersistentRBTree(PersistentRBTree &&m) : _root(m._root), _size(m._size) {
+    m._root = nullptr;
+    m._size = 0;
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp>::~PersistentRBTree() {
+    _release(_root);
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp> &PersistentRBTree<T, _Cmp>::operator=(const PersistentRBTree &m) {
+    PersistentRBTree(m).swap(*this);
+    return *this;
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp> &PersistentRBTree<T, _Cmp>::operator=(PersistentRBTree &&m) {
+    PersistentRBTree(std::move(m)).swap(*this);
+    return *this;
+}
+
+template <class T, typename _Cmp>
+bool PersistentRBTree<T, _Cmp>::empty() const noexcept {
+    return _size == 0;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::size_type PersistentRBTree<T, _Cmp>::size() const noexcept {
+    return _size;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::size_type PersistentRBTree<T, _Cmp>::max_size() const noexcept {
+    std::allocator<_Node> a;
+    return std::min(std::allocator_traits<std::allocator<_Node>>::max_size(a), _max_nodes);
+}
+
+template <class T, typename _Cmp>
+memory_footprint PersistentRBTree<T, _Cmp>::memory_usage() const {
+    memory_footprint usage = node_footprint(_size, sizeof(_Node), sizeof(T));
+    usage.metadata += sizeof(*this);
+    return usage;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::const_iterator PersistentRBTree<T, _Cmp>::begin() const noexcept {
+    const_iterator it(_root);
+    it.push_leftmost(_root);
+    return it;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::const_iterator PersistentRBTree<T, _Cmp>::end() const noexcept {
+    return const_iterator(_root);
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp> PersistentRBTree<T, _Cmp>::insert(const value_type &value) const {
+    PersistentRBTree version(*this);
+    if (!contains(value)) {
+        version._put(value, false);
+    }
+    return version;
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp> PersistentRBTree<T, _Cmp>::insert_or_assign(const value_type &value) const {
+    PersistentRBTree version(*this);
+    version._put(value, true);
+    return version;
+}
+
+template <class T, typename _Cmp>
+PersistentRBTree<T, _Cmp> PersistentRBTree<T, _Cmp>::erase(const key_type &key) const {
+    PersistentRBTree version(*this);
+    if (contains(key)) {
+        version._remove(key);
+    }
+    return version;
+}
+
+template <class T, typename _Cmp>
+void PersistentRBTree<T, _Cmp>::swap(PersistentRBTree &other) noexcept {
+    std::swap(_root, other._root);
+    std::swap(_size, other._size);
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::const_iterator PersistentRBTree<T, _Cmp>::find(
+    const key_type &key) const {
+    const_iterator it = lower_bound(key);
+    if (it.depth > 0 && _less(key, *it)) {
+        it.depth = 0;
+    }
+    return it;
+}
+
+template <class T, typename _Cmp>
+bool PersistentRBTree<T, _Cmp>::contains(const key_type &key) const {
+    _Node const *node = _root;
+    while (node != nullptr) {
+        if (_less(key, node->data)) {
+            node = node->left;
+        } else if (_less(node->data, key)) {
+            node = node->right;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::size_type PersistentRBTree<T, _Cmp>::count(const key_type &key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::const_iterator PersistentRBTree<T, _Cmp>::lower_bound(
+    const key_type &key) const {
+    return _bound(key, false);
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::const_iterator PersistentRBTree<T, _Cmp>::upper_bound(
+    const key_type &key) const {
+    return _bound(key, true);
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::const_iterator PersistentRBTree<T, _Cmp>::_bound(const key_type &key,
+                                                                                    bool upper) const {
+    /*  the answer is the deepest node where the descent turned left, so the
+     * path is cut back to it once the descent falls off the tree  */
+    const_iterator it(_root);
+    size_type found = 0;
+    for (_Node const *node = _root; node != nullptr;) {
+        it.path[it.depth++] = node;
+        if (upper ? _less(key, node->data) : !_less(node->data, key)) {
+            found = it.depth;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    it.depth = found;
+    return it;
+}
+
+template <class T, typename _Cmp>
+void PersistentRBTree<T, _Cmp>::_put(const value_type &value, bool assign) {
+    /*  the new node is made before the tree is touched, and the root and size
+     * are only published once the split and the join have succeeded. if one
+     * of them throws, this version is left empty. insert() and erase() work
+     * on a fresh version, so the one they were called on is never touched  */
+    if (_size == max_size() && !contains(value)) {
+        throw std::length_error("PersistentRBTree: too many keys");
+    }
+    _Node *fresh = new _Node(value);
+    _Node *root = _root;
+    size_type size = _size;
+    _root = nullptr;
+    _size = 0;
+    _Node *left = nullptr;
+    _Node *right = nullptr;
+    _Node *node = nullptr;
+    try {
+        node = _split(root, value, left, right);
+    } catch (...) {
+        delete fresh;
+        throw;
+    }
+    if (node == nullptr) {
+        node = fresh;
+        ++size;
+    } else if (assign) {
+        _release(node);
+        node = fresh;
+    } else {
+        delete fresh;
+    }
+    _root = _join(left, node, right);
+    _size = size;
+}
+
+template <class T, typename _Cmp>
+void PersistentRBTree<T, _Cmp>::_remove(const key_type &key) {
+    _Node *root = _root;
+    size_type size = _size;
+    _root = nullptr;
+    _size = 0;
+    _Node *left = nullptr;
+    _Node *right = nullptr;
+    _Node *node = _split(root, key, left, right);
+    if (node != nullptr) {
+        _release(node);
+        --size;
+    }
+    _root = _concat(left, right);
+    _size = size;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_acquire(_Node *node) {
+    if (node != nullptr) {
+        node->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+template <class T, typename _Cmp>
+void PersistentRBTree<T, _Cmp>::_release(_Node *node) {
+    while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        _release(node->left);
+        _Node *right = node->right;
+        delete node;
+        node = right;
+    }
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_own(_Node *node) {
+    if (node->refs.load(std::memory_order_acquire) != 1) {
+        _Node *copy = nullptr;
+        try {
+            copy = new _Node(*node);
+        } catch (...) {
+            _release(node);
+            throw;
+        }
+        _release(node);
+        node = copy;
+    }
+    return node;
+}
+
+template <class T, typename _Cmp>
+void PersistentRBTree<T, _Cmp>::_update(_Node *node) {
+    node->bh = static_cast<std::uint8_t>(_bh(node->left) + node->is_black());
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_blacken(_Node *node) {
+    if (_is_red(node)) {
+        node = _own(node);
+        node->color = PRBNodeBlack;
+        _update(node);
+    }
+    return node;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_rotate_left(_Node *node) {
+    _Node *right = node->right;
+    node->right = right->left;
+    right->left = node;
+    _update(node);
+    _update(right);
+    return right;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_rotate_right(_Node *node) {
+    _Node *left = node->left;
+    node->left = left->right;
+    left->right = node;
+    _update(node);
+    _update(left);
+    return left;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_join(_Node *left, _Node *node,
+                                                                           _Node *right) {
+    /*  same join by black height as RBTree::join_nodes, node is owned by the
+     * caller and has no children yet  */
+    try {
+        left = _blacken(left);
+    } catch (...) {
+        _release(node);
+        _release(right);
+        throw;
+    }
+    try {
+        right = _blacken(right);
+    } catch (...) {
+        _release(left);
+        _release(node);
+        throw;
+    }
+    _Node *root = nullptr;
+    if (_bh(left) > _bh(right)) {
+        root = _join_right(left, node, right);
+        if (root->is_red() && _is_red(root->right)) {
+            root->color = PRBNodeBlack;
+            _update(root);
+        }
+    } else if (_bh(left) < _bh(right)) {
+        root = _join_left(left, node, right);
+        if (root->is_red() && _is_red(root->left)) {
+            root->color = PRBNodeBlack;
+            _update(root);
+        }
+    } else {
+        node->left = left;
+        node->right = right;
+        node->color = PRBNodeRed;
+        _update(node);
+        root = node;
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_join_right(_Node *left, _Node *node,
+                                                                                 _Node *right) {
+    if (!_is_red(left) && _bh(left) == _bh(right)) {
+        node->left = left;
+        node->right = right;
+        node->color = PRBNodeRed;
+        _update(node);
+        return node;
+    }
+    try {
+        left = _own(left);
+    } catch (...) {
+        _release(node);
+        _release(right);
+        throw;
+    }
+    _Node *sub = left->right;
+    left->right = nullptr;
+    try {
+        left->right = _join_right(sub, node, right);
+    } catch (...) {
+        _release(left);
+        throw;
+    }
+    if (left->is_black() && _is_red(left->right) && _is_red(left->right->right)) {
+        _Node *red = left->right->right;
+        left->right->right = nullptr;
+        try {
+            red = _own(red);
+        } catch (...) {
+            _release(left);
+            throw;
+        }
+        red->color = PRBNodeBlack;
+        _update(red);
+        left->right->right = red;
+        left = _rotate_left(left);
+    } else {
+        _update(left);
+    }
+    return left;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_join_left(_Node *left, _Node *node,
+                                                                                _Node *right) {
+    if (!_is_red(right) && _bh(left) == _bh(right)) {
+        node->left = left;
+        node->right = right;
+        node->color = PRBNodeRed;
+        _update(node);
+        return node;
+    }
+    try {
+        right = _own(right);
+    } catch (...) {
+        _release(left);
+        _release(node);
+        throw;
+    }
+    _Node *sub = right->left;
+    right->left = nullptr;
+    try {
+        right->left = _join_left(left, node, sub);
+    } catch (...) {
+        _release(right);
+        throw;
+    }
+    if (right->is_black() && _is_red(right->left) && _is_red(right->left->left)) {
+        _Node *red = right->left->left;
+        right->left->left = nullptr;
+        try {
+            red = _own(red);
+        } catch (...) {
+            _release(right);
+            throw;
+        }
+        red->color = PRBNodeBlack;
+        _update(red);
+        right->left->left = red;
+        right = _rotate_right(right);
+    } else {
+        _update(right);
+    }
+    return right;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_split(_Node *node, const key_type &key,
+                                                                            _Node *&left, _Node *&right) {
+    _Node *found = nullptr;
+    if (node == nullptr) {
+        left = right = nullptr;
+    } else {
+        node = _own(node);
+        _Node *node_left = node->left;
+        _Node *node_right = node->right;
+        _Node *sub = nullptr;
+        node->left = node->right = nullptr;
+        if (_less(key, node->data)) {
+            try {
+                found = _split(node_left, key, left, sub);
+            } catch (...) {
+                _release(node);
+                _release(node_right);
+                throw;
+            }
+            try {
+                right = _join(sub, node, node_right);
+            } catch (...) {
+                _release(left);
+                _release(found);
+                throw;
+            }
+        } else if (_less(node->data, key)) {
+            try {
+                found = _split(node_right, key, sub, right);
+            } catch (...) {
+                _release(node);
+                _release(node_left);
+                throw;
+            }
+            try {
+                left = _join(node_left, node, sub);
+            } catch (...) {
+                _release(right);
+                _release(found);
+                throw;
+            }
+        } else {
+            found = node;
+            left = node_left;
+            right = node_right;
+        }
+    }
+    return found;
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_split_last(_Node *node,
+                                                                                 _Node *&last) {
+    node = _own(node);
+    _Node *node_left = node->left;
+    _Node *node_right = node->right;
+    node->left = node->right = nullptr;
+    if (node_right == nullptr) {
+        last = node;
+        return node_left;
+    }
+    _Node *rest = nullptr;
+    try {
+        rest = _split_last(node_right, last);
+    } catch (...) {
+        _release(node);
+        _release(node_left);
+        throw;
+    }
+    try {
+        return _join(node_left, node, rest);
+    } catch (...) {
+        _release(last);
+        throw;
+    }
+}
+
+template <class T, typename _Cmp>
+typename PersistentRBTree<T, _Cmp>::_Node *PersistentRBTree<T, _Cmp>::_concat(_Node *left, _Node *right) {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    _Node *last = nullptr;
+    _Node *rest = nullptr;
+    try {
+        rest = _split_last(left, last);
+    } catch (...) {
+        _release(right);
+        throw;
+    }
+    return _join(rest, last, right);
+}
+}  // namespace s21
+
+#endif  // SRC_PERSISTENTRBTREE_H_
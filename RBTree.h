@@ -1,9 +1,15 @@
 #ifndef SRC_RBTREE_H_
 #define SRC_RBTREE_H_
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 #include <utility>
 
+#include "ContainerStats.h"
+#include "MemoryUsage.h"
+
 #define RBNodeLeftChild -1
 #define RBNodeNotAChild 0
 #define RBNodeRightChild 1
@@ -22,6 +28,7 @@ class RBTree {
     struct _Node;
     struct _RBTree_iterator;
     struct _RBTree_const_iterator;
+    struct _Inline_fork;
 
  public:
     using key_type = T;
@@ -32,7 +39,12 @@ class RBTree {
     using const_iterator = _RBTree_const_iterator;
     using size_type = std::size_t;
 
-    bool compare(T a, T b, _Cmp cmp = _Cmp{}) { return cmp(a, b); }
+    static size_type const lookup_lanes = 16;
+
+    bool compare(T a, T b, _Cmp cmp = _Cmp{}) {
+        S21_STATS_ADD(comparisons, 1);
+        return cmp(a, b);
+    }
 
     RBTree();
     explicit RBTree(std::initializer_list<value_type> const &items);
@@ -53,11 +65,30 @@ class RBTree {
     void clear();
     std::pair<iterator, bool> insert(const value_type &value);
     void erase(iterator pos);
+    void erase(iterator first, iterator last);
+    size_type erase(const key_type &key);
+    template <typename Pred>
+    size_type erase_if(Pred pred);
     void swap(RBTree<T, _Cmp> &other);
     void merge(RBTree<T, _Cmp> &other);
+    RBTree split(const key_type &key);
+    void join(RBTree<T, _Cmp> &other);
+    template <typename Fork = _Inline_fork>
+    void unite(RBTree<T, _Cmp> &other, size_type depth = 0, Fork const &fork = Fork());
+    template <typename Fork = _Inline_fork>
+    void intersect(RBTree<T, _Cmp> &other, size_type depth = 0, Fork const &fork = Fork());
+    template <typename Fork = _Inline_fork>
+    void subtract(RBTree<T, _Cmp> &other, size_type depth = 0, Fork const &fork = Fork());
+    void assign_union(RBTree<T, _Cmp> const &a, RBTree<T, _Cmp> const &b);
+    void assign_intersection(RBTree<T, _Cmp> const &a, RBTree<T, _Cmp> const &b);
+    void assign_difference(RBTree<T, _Cmp> const &a, RBTree<T, _Cmp> const &b);
 
     iterator find(const key_type &key);
     bool contains(const key_type &key);
+    template <size_type Lanes = lookup_lanes>
+    void find_many(const key_type *keys, size_type count, iterator *out);
+    template <size_type Lanes = lookup_lanes>
+    void contains_many(const key_type *keys, size_type count, bool *out);
     size_type count(const key_type &key);
     std::pair<iterator, iterator> equal_range(const key_type &key);
     iterator lower_bound(const key_type &key);
@@ -65,11 +96,18 @@ class RBTree {
     template <typename... Args>
     std::pair<iterator, bool> emplace(Args &&...args);
 
+    container_stats stats() const { return S21_STATS_SNAPSHOT(); }
+    memory_footprint memory_usage() const;
+
  private:
     size_type _size;
     _Node *_head;
     _Node *_end;
 
+
+
+    S21_STATS_COUNTERS
+
     std::allocator<_Node> _a;
     using _node_manager = std::allocator_traits<std::allocator<_Node>>;
 
@@ -78,23 +116,38 @@ class RBTree {
         _Node *parent;
         _Node *left;
         _Node *right;
+        /*  nodes in the subtree rooted here, so that split() can size both
+         * halves from their roots  */
+        size_type count;
         bool color;
+#ifdef S21_RBTREE_THREADED
+        /*  in-order neighbours, so that stepping an iterator is a single
+         * load. the first node's prev and the last node's next are the
+         * sentinel, the sentinel's prev is the last node and its next is the
+         * sentinel itself, so ++end() stays at end() as without threads  */
+        _Node *prev = nullptr;
+        _Node *next = nullptr;
+#endif
+
+        S21_TRACKED_NODE("rbtree")
 
         _Node()
-            : parent(nullptr), left(nullptr), right(nullptr), color(RBNodeBlack) {}
+            : parent(nullptr), left(nullptr), right(nullptr), count(1), color(RBNodeBlack) {}
         explicit _Node(const_reference _data)
             : data(_data),
               parent(nullptr),
               left(nullptr),
               right(nullptr),
+              count(1),
               color(RBNodeBlack) {}
         explicit _Node(_Node *_parent)
-            : parent(_parent), left(nullptr), right(nullptr), color(RBNodeBlack) {}
+            : parent(_parent), left(nullptr), right(nullptr), count(1), color(RBNodeBlack) {}
         _Node(const_reference _data, _Node *_parent)
             : data(_data),
               parent(_parent),
               left(nullptr),
               right(nullptr),
+              count(1),
               color(RBNodeBlack) {}
         bool is_end() const { return (left != nullptr && left == right); }
         bool is_left_child() const {
@@ -116,6 +169,10 @@ class RBTree {
         }
         void make_red() { color = RBNodeRed; }
         void make_black() { color = RBNodeBlack; }
+        static size_type count_of(_Node const *node) {
+            return (node == nullptr) ? 0 : node->count;
+        }
+        void update_count() { count = 1 + count_of(left) + count_of(right); }
         void destroy_all_children() {
             if (left != nullptr) {
                 left->destroy_all_children();
@@ -159,6 +216,7 @@ class RBTree {
             std::swap(parent, other->parent);
             std::swap(left, other->left);
             std::swap(right, other->right);
+            std::swap(count, other->count);
             std::swap(color, other->color);
         }
         _Node *find_sibling() {
@@ -170,28 +228,7 @@ class RBTree {
             }
             return sibling;
         }
-    };
-
-    int find_parent_for_new_node(_Node *new_node, _Node *parent);
-    void rebalance_after_insertion(_Node *new_node);
-    void rebalance_before_deletion(_Node *node);
-    void rotate_left(_Node *node);
-    void rotate_right(_Node *node);
-
-    struct _RBTree_iterator {
-        using _self = _RBTree_iterator;
-
-        _Node *node;
-
-        explicit _RBTree_iterator(_Node *_node) noexcept : node(_node) {}
-
-        operator _RBTree_const_iterator() const {
-            return _RBTree_const_iterator(node);
-        }
-
-        reference operator*() const noexcept { return node->data; }
-
-        _self &operator++() noexcept {
+        static _Node *in_order_next(_Node *node) {
             if (node->is_end() == false) {
                 if (node->right != nullptr) {
                     node = node->right;
@@ -207,16 +244,9 @@ class RBTree {
                     }
                 }
             }
-            return *this;
+            return node;
         }
-
-        _self operator++(int) noexcept {
-            auto it = *this;
-            ++(*this);
-            return it;
-        }
-
-        _self &operator--() noexcept {
+        static _Node *in_order_prev(_Node *node) {
             if (node->is_end() == false) {
                 if (node->left != nullptr) {
                     node = node->left;
@@ -234,6 +264,106 @@ class RBTree {
                     node = node->right;
                 }
             }
+            return node;
+        }
+#ifdef S21_RBTREE_THREADED
+        static _Node *step_next(_Node *node) { return node->next; }
+        static _Node *step_prev(_Node *node) { return node->prev; }
+#else
+        static _Node *step_next(_Node *node) { return in_order_next(node); }
+        static _Node *step_prev(_Node *node) { return in_order_prev(node); }
+#endif
+    };
+
+    int find_parent_for_new_node(_Node *new_node, _Node *parent);
+    void rebalance_after_insertion(_Node *new_node);
+    void rebalance_before_deletion(_Node *node);
+    void rotate_left(_Node *node);
+    void rotate_right(_Node *node);
+    _Node *extract(iterator pos);
+    void append(RBTree<T, _Cmp> &other);
+    void split_at(_Node *node, RBTree<T, _Cmp> &right);
+    static size_type black_height(_Node *node);
+    _Node *join_nodes(_Node *left, size_type left_bh, _Node *pivot, _Node *right,
+                      size_type right_bh, size_type &bh);
+    _Node *join_right(_Node *left, size_type left_bh, _Node *pivot, _Node *right,
+                      size_type right_bh);
+    _Node *join_left(_Node *left, size_type left_bh, _Node *pivot, _Node *right,
+                     size_type right_bh);
+    static void link(_Node *node, _Node *left, _Node *right);
+    _Node *clone_nodes(_Node const *node, _Node *parent);
+    _Node *clone_node(_Node const *node);
+    _Node *probe(RBTree<T, _Cmp> const &tree, const key_type &key);
+    _Node *detach_root();
+    void attach_root(_Node *root, size_type size);
+    template <typename Fork, typename Left, typename Right>
+    static void invoke(size_type depth, Fork const &fork, Left left, Right right);
+    static void destroy_nodes(_Node *node);
+    _Node *split_nodes(_Node *node, size_type node_bh, const key_type &key,
+                       _Node *&left, size_type &left_bh, _Node *&right,
+                       size_type &right_bh);
+    _Node *split_last(_Node *node, size_type node_bh, _Node *&last, size_type &bh);
+    _Node *concat_nodes(_Node *left, size_type left_bh, _Node *right,
+                        size_type right_bh, size_type &bh);
+    template <typename Fork>
+    _Node *union_nodes(_Node *a, size_type a_bh, _Node *b, size_type b_bh,
+                       size_type depth, Fork const &fork, size_type &bh, size_type &matches);
+    template <typename Fork>
+    _Node *intersection_nodes(_Node *a, size_type a_bh, _Node *b, size_type b_bh,
+                              size_type depth, Fork const &fork, size_type &bh, size_type &matches);
+    template <typename Fork>
+    _Node *difference_nodes(_Node *a, size_type a_bh, _Node *b, size_type b_bh,
+                            size_type depth, Fork const &fork, size_type &bh, size_type &matches);
+    void rebuild(_Node **nodes, size_type count);
+    _Node *leftmost() const;
+    _Node *rightmost() const;
+    _Node *lower_bound_node(const key_type &key);
+    template <size_type Lanes>
+    void find_nodes(const key_type *keys, size_type count, _Node **found);
+    static void prefetch(_Node const *node);
+    void thread_all();
+    void thread_node(_Node *node);
+    void unthread_node(_Node *node);
+    void split_threads(_Node *first, RBTree<T, _Cmp> &right);
+    void join_threads(_Node *pivot, RBTree<T, _Cmp> &other);
+    void reset_threads();
+    _Node *build_balanced(_Node **nodes, size_type first, size_type last,
+                          size_type depth, size_type max_depth, _Node *parent);
+
+    struct _Inline_fork {
+        template <typename Left, typename Right>
+        void operator()(Left &left, Right &right) const {
+            left();
+            right();
+        }
+    };
+
+    struct _RBTree_iterator {
+        using _self = _RBTree_iterator;
+
+        _Node *node;
+
+        explicit _RBTree_iterator(_Node *_node) noexcept : node(_node) {}
+
+        operator _RBTree_const_iterator() const {
+            return _RBTree_const_iterator(node);
+        }
+
+        reference operator*() const noexcept { return node->data; }
+
+        _self &operator++() noexcept {
+            node = _Node::step_next(node);
+            return *this;
+        }
+
+        _self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _self &operator--() noexcept {
+            node = _Node::step_prev(node);
             return *this;
         }
 
@@ -263,21 +393,7 @@ class RBTree {
         const_reference operator*() const noexcept { return node->data; }
 
         _self &operator++() noexcept {
-            if (node->is_end() == false) {
-                if (node->right != nullptr) {
-                    node = node->right;
-                    while (node->left != nullptr) {
-                        node = node->left;
-                    }
-                } else {
-                    while (node->is_right_child()) {
-                        node = node->parent;
-                    }
-                    if (node->is_end() == false) {
-                        node = node->parent;
-                    }
-                }
-            }
+            node = _Node::step_next(const_cast<_Node *>(node));
             return *this;
         }
 
@@ -288,23 +404,7 @@ class RBTree {
         }
 
         _self &operator--() noexcept {
-            if (node->is_end() == false) {
-                if (node->left != nullptr) {
-                    node = node->left;
-                    while (node->right != nullptr) {
-                        node = node->right;
-                    }
-                } else {
-                    while (node->is_left_child()) {
-                        node = node->parent;
-                    }
-                    node = node->parent;
-                }
-            } else {
-                while (node->right != nullptr) {
-                    node = node->right;
-                }
-            }
+            node = _Node::step_prev(const_cast<_Node *>(node));
             return *this;
         }
 
@@ -325,7 +425,10 @@ class RBTree {
 };
 
 template <class T, typename _Cmp>
-RBTree<T, _Cmp>::RBTree() : _size(0), _head(nullptr), _end(new _Node()) {}
+RBTree<T, _Cmp>::RBTree() : _size(0), _head(nullptr), _end(new _Node()) {
+    S21_STATS_ADD(allocations, 1);
+    reset_threads();
+}
 
 template <class T, typename _Cmp>
 RBTree<T, _Cmp>::RBTree(std::initializer_list<value_type> const &items)
@@ -337,9 +440,10 @@ RBTree<T, _Cmp>::RBTree(std::initializer_list<value_type> const &items)
 
 template <class T, typename _Cmp>
 RBTree<T, _Cmp>::RBTree(const RBTree &m) : RBTree() {
-    for (auto it = m.begin(); it != m.end(); ++it) {
-        insert(*it);
-    }
+    _head = clone_nodes(m._head, _end);
+    _end->left = _end->right = _head;
+    _size = m._size;
+    thread_all();
 }
 
 template <class T, typename _Cmp>
@@ -372,29 +476,13 @@ RBTree<T, _Cmp> &RBTree<T, _Cmp>::operator=(RBTree &&m) {
 
 template <class T, typename _Cmp>
 typename RBTree<T, _Cmp>::iterator RBTree<T, _Cmp>::begin() noexcept {
-    _Node *first = _head;
-    if (first == nullptr) {
-        first = _end;
-    } else {
-        while (first->left != nullptr) {
-            first = first->left;
-        }
-    }
-    return _RBTree_iterator(first);
+    return _RBTree_iterator(leftmost());
 }
 
 template <class T, typename _Cmp>
 typename RBTree<T, _Cmp>::const_iterator RBTree<T, _Cmp>::begin()
     const noexcept {
-    _Node *first = _head;
-    if (first == nullptr) {
-        first = _end;
-    } else {
-        while (first->left != nullptr) {
-            first = first->left;
-        }
-    }
-    return _RBTree_const_iterator(first);
+    return _RBTree_const_iterator(leftmost());
 }
 
 template <class T, typename _Cmp>
@@ -422,17 +510,29 @@ typename RBTree<T, _Cmp>::size_type RBTree<T, _Cmp>::max_size() const noexcept {
     return _node_manager::max_size(_a);
 }
 
+template <class T, typename _Cmp>
+memory_footprint RBTree<T, _Cmp>::memory_usage() const {
+    memory_footprint usage = node_footprint(size(), sizeof(_Node), sizeof(T));
+    usage.metadata += sizeof(*this);
+    if (_end != nullptr) {
+        usage.metadata += sizeof(_Node);
+        usage.overhead += heap_block_overhead(sizeof(_Node));
+    }
+    return usage;
+}
+
 template <class T, typename _Cmp>
 void RBTree<T, _Cmp>::clear() {
     if (_head != nullptr) {
         _head->destroy_all_children();
         delete _head;
         _head = nullptr;
-        _size = 0;
     }
+    _size = 0;
     if (_end != nullptr) {
         _end->left = _end->right = nullptr;
     }
+    reset_threads();
 }
 
 template <class T, typename _Cmp>
@@ -442,6 +542,8 @@ std::pair<typename RBTree<T, _Cmp>::iterator, bool> RBTree<T, _Cmp>::insert(
      * https://www.youtube.com/watch?v=UaLIHuR1t8Q  */
     bool result = true;
     _Node *new_node = new _Node(value);
+    S21_STATS_ADD(allocations, 1);
+    S21_STATS_ADD(copies, 1);
     new_node->make_red();
     if (_head == nullptr) {
         _head = new_node;
@@ -457,6 +559,10 @@ std::pair<typename RBTree<T, _Cmp>::iterator, bool> RBTree<T, _Cmp>::insert(
         }
     }
     if (result == true) {
+        for (_Node *node = new_node->parent; node != _end; node = node->parent) {
+            node->count++;
+        }
+        thread_node(new_node);
         rebalance_after_insertion(new_node);
         while (_head->parent != _end) {
             _head = _head->parent;
@@ -543,6 +649,7 @@ template <class T, typename _Cmp>
 void RBTree<T, _Cmp>::rotate_right(_Node *node) {
     _Node *left_child = node->left;
     if (left_child != nullptr) {
+        S21_STATS_ADD(rotations, 1);
         node->left = left_child->right;
         if (left_child->right != nullptr) {
             left_child->right->parent = node;
@@ -555,6 +662,8 @@ void RBTree<T, _Cmp>::rotate_right(_Node *node) {
             left_child->parent->right = left_child;
         }
         node->parent = left_child;
+        node->update_count();
+        left_child->update_count();
     }
 }
 
@@ -562,6 +671,7 @@ template <class T, typename _Cmp>
 void RBTree<T, _Cmp>::rotate_left(_Node *node) {
     _Node *right_child = node->right;
     if (right_child != nullptr) {
+        S21_STATS_ADD(rotations, 1);
         node->right = right_child->left;
         if (right_child->left != nullptr) {
             right_child->left->parent = node;
@@ -575,13 +685,16 @@ void RBTree<T, _Cmp>::rotate_left(_Node *node) {
             right_child->parent->right = right_child;
         }
         node->parent = right_child;
+        node->update_count();
+        right_child->update_count();
     }
 }
 
 template <class T, typename _Cmp>
-void RBTree<T, _Cmp>::erase(iterator pos) {
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::extract(iterator pos) {
     /*  deletion algorithm described here:
      * https://youtu.be/CTvfzU_uNKE  */
+    unthread_node(pos.node);
     if (pos.node->has_both_children()) {
         _Node *min_on_the_right = pos.node->right;
         while (min_on_the_right->left != nullptr) {
@@ -597,6 +710,10 @@ void RBTree<T, _Cmp>::erase(iterator pos) {
         _Node *child = pos.node->some_child();
         pos.node->swap_with(child);
         child->left = child->right = nullptr;
+        child->count = 1;
+        for (_Node *node = child->parent; node != _end; node = node->parent) {
+            node->count--;
+        }
         while (_head->parent != _end) {
             _head = _head->parent;
         }
@@ -611,9 +728,106 @@ void RBTree<T, _Cmp>::erase(iterator pos) {
         } else if (pos.node->is_right_child()) {
             parent->right = nullptr;
         }
+        for (_Node *node = parent; node != _end; node = node->parent) {
+            node->count--;
+        }
     }
-    delete pos.node;
+    pos.node->parent = pos.node->left = pos.node->right = nullptr;
     _size--;
+    return pos.node;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::erase(iterator pos) {
+    delete extract(pos);
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::erase(iterator first, iterator last) {
+    /*  both splits are O(log n), only the k erased nodes are visited when
+     * middle is destroyed  */
+    if (first != last) {
+        RBTree<T, _Cmp> middle;
+        split_at(first.node, middle);
+        if (last.node != _end) {
+            RBTree<T, _Cmp> right;
+            middle.split_at(last.node, right);
+            append(right);
+        }
+    }
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::size_type RBTree<T, _Cmp>::erase(
+    const key_type &key) {
+    /*  a key matches one node or a short run of them, extracting each is
+     * cheaper than splitting the run out and joining the rest back  */
+    size_type count = 0;
+    iterator last = upper_bound(key);
+    for (iterator it = lower_bound(key); it != last; count++) {
+        delete extract(it++);
+    }
+    return count;
+}
+
+template <class T, typename _Cmp>
+template <typename Pred>
+typename RBTree<T, _Cmp>::size_type RBTree<T, _Cmp>::erase_if(Pred pred) {
+    /*  pred sees every node before anything is unlinked: kept nodes fill the
+     * buffer from the front in order, erased ones from the back. a throwing
+     * pred leaves the tree as it was and the buffer is freed either way  */
+    size_type total = size();
+    std::unique_ptr<_Node *[]> nodes(new _Node *[total]);
+    size_type kept = 0;
+    size_type back = total;
+    for (auto it = begin(); it != end(); ++it) {
+        if (pred(*it)) {
+            nodes[--back] = it.node;
+        } else {
+            nodes[kept++] = it.node;
+        }
+    }
+    rebuild(nodes.get(), kept);
+    for (size_type i = kept; i < total; ++i) {
+        delete nodes[i];
+    }
+    return total - kept;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::rebuild(_Node **nodes, size_type count) {
+    size_type max_depth = 0;
+    while ((count >> (max_depth + 1)) != 0) {
+        max_depth++;
+    }
+    _head = build_balanced(nodes, 0, count, 0, max_depth, _end);
+    _end->left = _end->right = _head;
+    _size = count;
+    thread_all();
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::build_balanced(
+    _Node **nodes, size_type first, size_type last, size_type depth,
+    size_type max_depth, _Node *parent) {
+    /*  every leaf of a midpoint-split tree sits on one of the two deepest
+     * levels, so painting the deepest level red keeps black heights equal  */
+    _Node *node = nullptr;
+    if (first < last) {
+        size_type mid = first + (last - first) / 2;
+        node = nodes[mid];
+        node->parent = parent;
+        node->left = build_balanced(nodes, first, mid, depth + 1, max_depth, node);
+        node->right =
+            build_balanced(nodes, mid + 1, last, depth + 1, max_depth, node);
+        node->update_count();
+        if (depth == max_depth && depth > 0) {
+            node->make_red();
+        } else {
+            node->make_black();
+        }
+    }
+    return node;
 }
 
 template <class T, typename _Cmp>
@@ -621,58 +835,62 @@ void RBTree<T, _Cmp>::rebalance_before_deletion(_Node *node) {
     if (node->parent == _end) {
         _head = nullptr;
         _end->left = _end->right = _head;
-    } else {
+    }
+    /*  node carries an extra black: either push it up to the parent or
+     * absorb it with at most two rotations around the parent  */
+    bool done = false;
+    while (done == false && node->parent != _end) {
         _Node *parent_ = node->parent;
         _Node *sibling = node->find_sibling();
-        if (sibling != nullptr && sibling->is_red()) {
-            if (node->is_left_child()) {
+        bool is_left = node->is_left_child();
+        if (sibling->is_red()) {
+            if (is_left) {
                 rotate_left(parent_);
             } else {
                 rotate_right(parent_);
             }
-            if (sibling->parent == _end) {
-                _head = sibling;
-                _end->left = _end->right = _head;
-            }
             parent_->make_red();
             sibling->make_black();
+            sibling = node->find_sibling();
         }
-        sibling = node->find_sibling();
-        if (parent_->is_black() && sibling != nullptr && sibling->is_black() &&
-            sibling->has_red_child() == false) {
-            sibling->make_red();
-            rebalance_before_deletion(parent_);
-        } else if (parent_->is_red() && sibling != nullptr && sibling->is_black() &&
-                   sibling->has_red_child() == false) {
-            parent_->make_black();
+        _Node *far_child = is_left ? sibling->right : sibling->left;
+        _Node *near_child = is_left ? sibling->left : sibling->right;
+        if ((far_child == nullptr || far_child->is_black()) &&
+            (near_child == nullptr || near_child->is_black())) {
             sibling->make_red();
+            if (parent_->is_red()) {
+                parent_->make_black();
+                done = true;
+            }
+            node = parent_;
         } else {
-            if (node->is_left_child() && sibling->right != nullptr &&
-                sibling->right->is_black() && sibling->left != nullptr &&
-                sibling->left->is_red()) {
-                rotate_right(sibling);
-                sibling->parent->make_black();
-                sibling->make_red();
-            } else if (node->is_right_child() && sibling->right != nullptr &&
-                       sibling->right->is_red() && sibling->left != nullptr &&
-                       sibling->left->is_black()) {
-                rotate_left(sibling);
-                sibling->parent->make_black();
+            if (far_child == nullptr || far_child->is_black()) {
+                if (is_left) {
+                    rotate_right(sibling);
+                } else {
+                    rotate_left(sibling);
+                }
+                near_child->make_black();
                 sibling->make_red();
+                far_child = sibling;
+                sibling = near_child;
             }
-            sibling = node->find_sibling();
-            if (node->is_left_child()) {
+            if (is_left) {
                 rotate_left(parent_);
             } else {
                 rotate_right(parent_);
             }
             sibling->color = parent_->color;
             parent_->make_black();
-            if (sibling->parent == _end) {
-                _head = sibling;
-                _end->left = _end->right = _head;
-            }
+            far_child->make_black();
+            done = true;
+        }
+    }
+    if (_head != nullptr) {
+        while (_head->parent != _end) {
+            _head = _head->parent;
         }
+        _end->left = _end->right = _head;
     }
 }
 
@@ -684,6 +902,7 @@ void RBTree<T, _Cmp>::swap(RBTree<T, _Cmp> &other) {
     tmp = _end;
     _end = other._end;
     other._end = tmp;
+    std::swap(_size, other._size);
 }
 
 template <class T, typename _Cmp>
@@ -693,6 +912,598 @@ void RBTree<T, _Cmp>::merge(RBTree<T, _Cmp> &other) {
     }
 }
 
+template <class T, typename _Cmp>
+RBTree<T, _Cmp> RBTree<T, _Cmp>::split(const key_type &key) {
+    RBTree<T, _Cmp> right;
+    split_at(lower_bound_node(key), right);
+    return right;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::join(RBTree<T, _Cmp> &other) {
+    if (empty() == false && other.empty() == false) {
+        if (compare(rightmost()->data, other.leftmost()->data) == false) {
+            if (compare(other.rightmost()->data, leftmost()->data) == false) {
+                throw std::invalid_argument("RBTree::join: key ranges overlap");
+            }
+            swap(other);
+        }
+    }
+    append(other);
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::append(RBTree<T, _Cmp> &other) {
+    if (other.empty() == false) {
+        if (empty()) {
+            swap(other);
+        } else {
+            size_type total = _size + other._size;
+            _Node *pivot = other.extract(iterator(other.leftmost()));
+            join_threads(pivot, other);
+            size_type bh = 0;
+            _head = join_nodes(_head, black_height(_head), pivot, other._head,
+                               black_height(other._head), bh);
+            _head->parent = _end;
+            _end->left = _end->right = _head;
+            _size = total;
+            other._head = nullptr;
+            other._end->left = other._end->right = nullptr;
+            other._size = 0;
+            other.reset_threads();
+        }
+    }
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::split_at(_Node *node, RBTree<T, _Cmp> &right) {
+    /*  walks from node up to the root, joining every ancestor with its other
+     * subtree onto the left or the right half, black heights telescope so
+     * the whole split costs O(log n). the joins keep subtree counts, so both
+     * sizes are read off the new roots  */
+    right.clear();
+    if (node == leftmost()) {
+        swap(right);
+    } else if (node != _end) {
+        size_type height = black_height(node);
+        size_type child_bh = height - node->is_black();
+        _Node *parent = node->parent;
+        bool is_left = node->is_left_child();
+        _Node *left_root = node->left;
+        size_type left_bh = child_bh;
+        size_type right_bh = 0;
+        _Node *right_root =
+            join_nodes(nullptr, 0, node, node->right, child_bh, right_bh);
+        while (parent != _end) {
+            _Node *cur = parent;
+            bool cur_is_left = cur->is_left_child();
+            bool cur_is_black = cur->is_black();
+            parent = cur->parent;
+            if (is_left) {
+                right_root = join_nodes(right_root, right_bh, cur, cur->right, height, right_bh);
+            } else {
+                left_root = join_nodes(cur->left, height, cur, left_root, left_bh, left_bh);
+            }
+            height += cur_is_black;
+            is_left = cur_is_left;
+        }
+        if (left_root != nullptr) {
+            left_root->parent = _end;
+            left_root->make_black();
+        }
+        _head = left_root;
+        _end->left = _end->right = _head;
+        right._head = right_root;
+        right_root->parent = right._end;
+        right._end->left = right._end->right = right._head;
+        _size = _Node::count_of(left_root);
+        right._size = right_root->count;
+        split_threads(node, right);
+    }
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::size_type RBTree<T, _Cmp>::black_height(_Node *node) {
+    size_type height = 0;
+    for (; node != nullptr; node = node->left) {
+        height += node->is_black();
+    }
+    return height;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::join_nodes(
+    _Node *left, size_type left_bh, _Node *pivot, _Node *right,
+    size_type right_bh, size_type &bh) {
+    /*  join by black height described here:
+     * https://arxiv.org/abs/1602.02120  */
+    if (left != nullptr) {
+        left->parent = nullptr;
+        if (left->is_red()) {
+            left->make_black();
+            left_bh++;
+        }
+    }
+    if (right != nullptr) {
+        right->parent = nullptr;
+        if (right->is_red()) {
+            right->make_black();
+            right_bh++;
+        }
+    }
+    _Node *root = pivot;
+    if (left_bh > right_bh) {
+        root = join_right(left, left_bh, pivot, right, right_bh);
+        bh = left_bh;
+    } else if (left_bh < right_bh) {
+        root = join_left(left, left_bh, pivot, right, right_bh);
+        bh = right_bh;
+    } else {
+        link(pivot, left, right);
+        pivot->make_black();
+        bh = left_bh + 1;
+    }
+    root->parent = nullptr;
+    if (root->is_red()) {
+        root->make_black();
+        bh++;
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::join_right(
+    _Node *left, size_type left_bh, _Node *pivot, _Node *right,
+    size_type right_bh) {
+    _Node *root = left;
+    if ((left == nullptr || left->is_black()) && left_bh == right_bh) {
+        link(pivot, left, right);
+        pivot->make_red();
+        root = pivot;
+    } else {
+        _Node *sub = join_right(left->right, left_bh - left->is_black(), pivot,
+                                right, right_bh);
+        left->right = sub;
+        sub->parent = left;
+        left->update_count();
+        if (left->is_black() && sub->is_red() && sub->right != nullptr &&
+            sub->right->is_red()) {
+            sub->right->make_black();
+            rotate_left(left);
+            root = sub;
+        }
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::join_left(
+    _Node *left, size_type left_bh, _Node *pivot, _Node *right,
+    size_type right_bh) {
+    _Node *root = right;
+    if ((right == nullptr || right->is_black()) && left_bh == right_bh) {
+        link(pivot, left, right);
+        pivot->make_red();
+        root = pivot;
+    } else {
+        _Node *sub = join_left(left, left_bh, pivot, right->left,
+                               right_bh - right->is_black());
+        right->left = sub;
+        sub->parent = right;
+        right->update_count();
+        if (right->is_black() && sub->is_red() && sub->left != nullptr &&
+            sub->left->is_red()) {
+            sub->left->make_black();
+            rotate_right(right);
+            root = sub;
+        }
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::link(_Node *node, _Node *left, _Node *right) {
+    node->left = left;
+    node->right = right;
+    if (left != nullptr) {
+        left->parent = node;
+    }
+    if (right != nullptr) {
+        right->parent = node;
+    }
+    node->update_count();
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::clone_nodes(_Node const *node,
+                                                             _Node *parent) {
+    _Node *copy = nullptr;
+    if (node != nullptr) {
+        copy = new _Node(node->data, parent);
+        S21_STATS_ADD(allocations, 1);
+        S21_STATS_ADD(copies, 1);
+        copy->color = node->color;
+        copy->count = node->count;
+        copy->left = clone_nodes(node->left, copy);
+        copy->right = clone_nodes(node->right, copy);
+    }
+    return copy;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::clone_node(_Node const *node) {
+    S21_STATS_ADD(allocations, 1);
+    S21_STATS_ADD(copies, 1);
+    return new _Node(node->data);
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::probe(RBTree<T, _Cmp> const &tree,
+                                                       const key_type &key) {
+    _Node *node = tree._head;
+    while (node != nullptr && compare(node->data, key) != compare(key, node->data)) {
+        node = compare(node->data, key) ? node->right : node->left;
+    }
+    return node;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::assign_union(RBTree<T, _Cmp> const &a, RBTree<T, _Cmp> const &b) {
+    /*  the assign_ operations only read their inputs and copy the keys of
+     * the result, which the output already costs for a union: one merge of
+     * the two in-order walks, then a balanced build from the sorted copies  */
+    clear();
+    std::allocator<_Node *> alloc;
+    size_type capacity = a._size + b._size + 1;
+    _Node **nodes = alloc.allocate(capacity);
+    size_type count = 0;
+    _Node *x = a.leftmost();
+    _Node *y = b.leftmost();
+    while (x != a._end || y != b._end) {
+        if (y == b._end || (x != a._end && compare(x->data, y->data))) {
+            nodes[count++] = clone_node(x);
+            x = _Node::in_order_next(x);
+        } else {
+            if (x != a._end && compare(y->data, x->data) == false) {
+                x = _Node::in_order_next(x);
+            }
+            nodes[count++] = clone_node(y);
+            y = _Node::in_order_next(y);
+        }
+    }
+    rebuild(nodes, count);
+    alloc.deallocate(nodes, capacity);
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::assign_intersection(RBTree<T, _Cmp> const &a, RBTree<T, _Cmp> const &b) {
+    /*  the smaller tree is walked and every key is looked up in the larger
+     * one, O(m log n) for sizes m <= n  */
+    clear();
+    RBTree<T, _Cmp> const &small = (a._size <= b._size) ? a : b;
+    RBTree<T, _Cmp> const &large = (a._size <= b._size) ? b : a;
+    std::allocator<_Node *> alloc;
+    size_type capacity = small._size + 1;
+    _Node **nodes = alloc.allocate(capacity);
+    size_type count = 0;
+    for (_Node *x = small.leftmost(); x != small._end; x = _Node::in_order_next(x)) {
+        if (probe(large, x->data) != nullptr) {
+            nodes[count++] = clone_node(x);
+        }
+    }
+    rebuild(nodes, count);
+    alloc.deallocate(nodes, capacity);
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::assign_difference(RBTree<T, _Cmp> const &a, RBTree<T, _Cmp> const &b) {
+    /*  a smaller a is walked and looked up in b, O(m log n). otherwise the
+     * result is about as large as a, and one merge of both walks costs no
+     * more than copying it  */
+    clear();
+    std::allocator<_Node *> alloc;
+    size_type capacity = a._size + 1;
+    _Node **nodes = alloc.allocate(capacity);
+    size_type count = 0;
+    if (a._size <= b._size) {
+        for (_Node *x = a.leftmost(); x != a._end; x = _Node::in_order_next(x)) {
+            if (probe(b, x->data) == nullptr) {
+                nodes[count++] = clone_node(x);
+            }
+        }
+    } else {
+        _Node *y = b.leftmost();
+        for (_Node *x = a.leftmost(); x != a._end; x = _Node::in_order_next(x)) {
+            while (y != b._end && compare(y->data, x->data)) {
+                y = _Node::in_order_next(y);
+            }
+            if (y == b._end || compare(x->data, y->data)) {
+                nodes[count++] = clone_node(x);
+            }
+        }
+    }
+    rebuild(nodes, count);
+    alloc.deallocate(nodes, capacity);
+}
+
+template <class T, typename _Cmp>
+template <typename Fork>
+void RBTree<T, _Cmp>::unite(RBTree<T, _Cmp> &other, size_type depth, Fork const &fork) {
+    /*  join-based set operations described here:
+     * https://arxiv.org/abs/1602.02120
+     * each one costs O(m log(n / m + 1)) work. for the first depth levels
+     * of the recursion the two halves are handed to fork(left, right),
+     * which may run them in parallel, see s21_parallel_set_algebra.h  */
+    size_type a_bh = black_height(_head);
+    size_type b_bh = black_height(other._head);
+    size_type bh = 0;
+    size_type matches = 0;
+    size_type total = _size + other._size;
+    _Node *b = other.detach_root();
+    _Node *root = union_nodes(detach_root(), a_bh, b, b_bh, depth, fork, bh, matches);
+    attach_root(root, total - matches);
+}
+
+template <class T, typename _Cmp>
+template <typename Fork>
+void RBTree<T, _Cmp>::intersect(RBTree<T, _Cmp> &other, size_type depth, Fork const &fork) {
+    size_type a_bh = black_height(_head);
+    size_type b_bh = black_height(other._head);
+    size_type bh = 0;
+    size_type matches = 0;
+    _Node *b = other.detach_root();
+    _Node *root = intersection_nodes(detach_root(), a_bh, b, b_bh, depth, fork, bh, matches);
+    attach_root(root, matches);
+}
+
+template <class T, typename _Cmp>
+template <typename Fork>
+void RBTree<T, _Cmp>::subtract(RBTree<T, _Cmp> &other, size_type depth, Fork const &fork) {
+    size_type a_bh = black_height(_head);
+    size_type b_bh = black_height(other._head);
+    size_type bh = 0;
+    size_type matches = 0;
+    size_type total = _size;
+    _Node *b = other.detach_root();
+    _Node *root = difference_nodes(detach_root(), a_bh, b, b_bh, depth, fork, bh, matches);
+    attach_root(root, total - matches);
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::detach_root() {
+    _Node *root = _head;
+    if (root != nullptr) {
+        root->parent = nullptr;
+    }
+    _head = nullptr;
+    _end->left = _end->right = nullptr;
+    _size = 0;
+    reset_threads();
+    return root;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::attach_root(_Node *root, size_type size) {
+    _head = root;
+    _end->left = _end->right = _head;
+    _size = size;
+    if (root != nullptr) {
+        root->parent = _end;
+        root->make_black();
+        thread_all();
+    }
+}
+
+template <class T, typename _Cmp>
+template <typename Fork, typename Left, typename Right>
+void RBTree<T, _Cmp>::invoke(size_type depth, Fork const &fork, Left left, Right right) {
+    if (depth > 0) {
+        fork(left, right);
+    } else {
+        left();
+        right();
+    }
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::destroy_nodes(_Node *node) {
+    if (node != nullptr) {
+        node->destroy_all_children();
+        delete node;
+    }
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::split_nodes(
+    _Node *node, size_type node_bh, const key_type &key, _Node *&left,
+    size_type &left_bh, _Node *&right, size_type &right_bh) {
+    _Node *found = nullptr;
+    if (node == nullptr) {
+        left = right = nullptr;
+        left_bh = right_bh = 0;
+    } else {
+        size_type child_bh = node_bh - node->is_black();
+        _Node *node_left = node->left;
+        _Node *node_right = node->right;
+        _Node *sub = nullptr;
+        size_type sub_bh = 0;
+        if (compare(key, node->data)) {
+            found = split_nodes(node_left, child_bh, key, left, left_bh, sub, sub_bh);
+            right = join_nodes(sub, sub_bh, node, node_right, child_bh, right_bh);
+        } else if (compare(node->data, key)) {
+            found = split_nodes(node_right, child_bh, key, sub, sub_bh, right, right_bh);
+            left = join_nodes(node_left, child_bh, node, sub, sub_bh, left_bh);
+        } else {
+            found = node;
+            left = node_left;
+            right = node_right;
+            left_bh = right_bh = child_bh;
+            found->parent = found->left = found->right = nullptr;
+        }
+    }
+    return found;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::split_last(_Node *node,
+                                                            size_type node_bh,
+                                                            _Node *&last,
+                                                            size_type &bh) {
+    size_type child_bh = node_bh - node->is_black();
+    _Node *root = node->left;
+    if (node->right == nullptr) {
+        last = node;
+        bh = child_bh;
+    } else {
+        size_type sub_bh = 0;
+        _Node *sub = split_last(node->right, child_bh, last, sub_bh);
+        root = join_nodes(node->left, child_bh, node, sub, sub_bh, bh);
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::concat_nodes(
+    _Node *left, size_type left_bh, _Node *right, size_type right_bh,
+    size_type &bh) {
+    _Node *root = left;
+    bh = left_bh;
+    if (left == nullptr) {
+        root = right;
+        bh = right_bh;
+    } else if (right != nullptr) {
+        _Node *last = nullptr;
+        size_type rest_bh = 0;
+        _Node *rest = split_last(left, left_bh, last, rest_bh);
+        root = join_nodes(rest, rest_bh, last, right, right_bh, bh);
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+template <typename Fork>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::union_nodes(
+    _Node *a, size_type a_bh, _Node *b, size_type b_bh, size_type depth,
+    Fork const &fork, size_type &bh, size_type &matches) {
+    /*  matches counts the keys found in both trees, the callers derive the
+     * size of the result from it  */
+    _Node *root = a;
+    bh = a_bh;
+    matches = 0;
+    if (a == nullptr) {
+        root = b;
+        bh = b_bh;
+    } else if (b != nullptr) {
+        size_type child_bh = a_bh - a->is_black();
+        _Node *a_left = a->left;
+        _Node *a_right = a->right;
+        _Node *b_left = nullptr, *b_right = nullptr;
+        size_type b_left_bh = 0, b_right_bh = 0;
+        _Node *found = split_nodes(b, b_bh, a->data, b_left, b_left_bh, b_right, b_right_bh);
+        _Node *left = nullptr, *right = nullptr;
+        size_type left_bh = 0, right_bh = 0;
+        size_type left_matches = 0, right_matches = 0;
+        size_type next = (depth > 0) ? depth - 1 : 0;
+        invoke(
+            depth, fork,
+            [&] {
+                left = union_nodes(a_left, child_bh, b_left, b_left_bh, next, fork, left_bh, left_matches);
+            },
+            [&] {
+                right = union_nodes(a_right, child_bh, b_right, b_right_bh, next, fork, right_bh,
+                                    right_matches);
+            });
+        matches = left_matches + right_matches + (found != nullptr);
+        delete found;
+        root = join_nodes(left, left_bh, a, right, right_bh, bh);
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+template <typename Fork>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::intersection_nodes(
+    _Node *a, size_type a_bh, _Node *b, size_type b_bh, size_type depth,
+    Fork const &fork, size_type &bh, size_type &matches) {
+    _Node *root = nullptr;
+    bh = 0;
+    matches = 0;
+    if (a == nullptr || b == nullptr) {
+        destroy_nodes(a);
+        destroy_nodes(b);
+    } else {
+        size_type child_bh = a_bh - a->is_black();
+        _Node *a_left = a->left;
+        _Node *a_right = a->right;
+        _Node *b_left = nullptr, *b_right = nullptr;
+        size_type b_left_bh = 0, b_right_bh = 0;
+        _Node *found = split_nodes(b, b_bh, a->data, b_left, b_left_bh, b_right, b_right_bh);
+        _Node *left = nullptr, *right = nullptr;
+        size_type left_bh = 0, right_bh = 0;
+        size_type left_matches = 0, right_matches = 0;
+        size_type next = (depth > 0) ? depth - 1 : 0;
+        invoke(
+            depth, fork,
+            [&] {
+                left = intersection_nodes(a_left, child_bh, b_left, b_left_bh, next, fork, left_bh,
+                                          left_matches);
+            },
+            [&] {
+                right = intersection_nodes(a_right, child_bh, b_right, b_right_bh, next, fork, right_bh,
+                                           right_matches);
+            });
+        matches = left_matches + right_matches + (found != nullptr);
+        if (found != nullptr) {
+            delete found;
+            root = join_nodes(left, left_bh, a, right, right_bh, bh);
+        } else {
+            delete a;
+            root = concat_nodes(left, left_bh, right, right_bh, bh);
+        }
+    }
+    return root;
+}
+
+template <class T, typename _Cmp>
+template <typename Fork>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::difference_nodes(
+    _Node *a, size_type a_bh, _Node *b, size_type b_bh, size_type depth,
+    Fork const &fork, size_type &bh, size_type &matches) {
+    _Node *root = a;
+    bh = a_bh;
+    matches = 0;
+    if (a == nullptr) {
+        destroy_nodes(b);
+    } else if (b != nullptr) {
+        size_type child_bh = b_bh - b->is_black();
+        _Node *b_left = b->left;
+        _Node *b_right = b->right;
+        _Node *a_left = nullptr, *a_right = nullptr;
+        size_type a_left_bh = 0, a_right_bh = 0;
+        _Node *found = split_nodes(a, a_bh, b->data, a_left, a_left_bh, a_right, a_right_bh);
+        bool hit = (found != nullptr);
+        delete found;
+        delete b;
+        _Node *left = nullptr, *right = nullptr;
+        size_type left_bh = 0, right_bh = 0;
+        size_type left_matches = 0, right_matches = 0;
+        size_type next = (depth > 0) ? depth - 1 : 0;
+        invoke(
+            depth, fork,
+            [&] {
+                left = difference_nodes(a_left, a_left_bh, b_left, child_bh, next, fork, left_bh,
+                                        left_matches);
+            },
+            [&] {
+                right = difference_nodes(a_right, a_right_bh, b_right, child_bh, next, fork, right_bh,
+                                         right_matches);
+            });
+        matches = left_matches + right_matches + hit;
+        root = concat_nodes(left, left_bh, right, right_bh, bh);
+    }
+    return root;
+}
+
 template <class T, typename _Cmp>
 typename RBTree<T, _Cmp>::iterator RBTree<T, _Cmp>::find(const key_type &key) {
     _Node *res = _head;
@@ -716,14 +1527,83 @@ bool RBTree<T, _Cmp>::contains(const key_type &key) {
     return find(key) != end();
 }
 
+template <class T, typename _Cmp>
+template <typename RBTree<T, _Cmp>::size_type Lanes>
+void RBTree<T, _Cmp>::find_many(const key_type *keys, size_type count,
+                                iterator *out) {
+    for (size_type first = 0; first < count; first += Lanes) {
+        size_type lanes = std::min(count - first, Lanes);
+        _Node *found[Lanes];
+        find_nodes<Lanes>(keys + first, lanes, found);
+        for (size_type i = 0; i < lanes; ++i) {
+            out[first + i] = iterator((found[i] == nullptr) ? _end : found[i]);
+        }
+    }
+}
+
+template <class T, typename _Cmp>
+template <typename RBTree<T, _Cmp>::size_type Lanes>
+void RBTree<T, _Cmp>::contains_many(const key_type *keys, size_type count,
+                                    bool *out) {
+    for (size_type first = 0; first < count; first += Lanes) {
+        size_type lanes = std::min(count - first, Lanes);
+        _Node *found[Lanes];
+        find_nodes<Lanes>(keys + first, lanes, found);
+        for (size_type i = 0; i < lanes; ++i) {
+            out[first + i] = (found[i] != nullptr);
+        }
+    }
+}
+
+template <class T, typename _Cmp>
+template <typename RBTree<T, _Cmp>::size_type Lanes>
+void RBTree<T, _Cmp>::find_nodes(const key_type *keys, size_type count,
+                                 _Node **found) {
+    /*  the descents of up to Lanes keys advance one level per round, each
+     * lane prefetches its next node and the other lanes' compares run while
+     * it arrives, so the cache misses of a batch overlap instead of
+     * queueing up one find after another  */
+    _Node *cur[Lanes];
+    for (size_type i = 0; i < count; ++i) {
+        cur[i] = _head;
+        found[i] = nullptr;
+    }
+    size_type active = (_head == nullptr) ? 0 : count;
+    while (active > 0) {
+        active = 0;
+        for (size_type i = 0; i < count; ++i) {
+            _Node *node = cur[i];
+            if (node != nullptr) {
+                bool less = compare(node->data, keys[i]);
+                if (less == compare(keys[i], node->data)) {
+                    found[i] = node;
+                    node = nullptr;
+                } else {
+                    node = less ? node->right : node->left;
+                    prefetch(node);
+                    active += (node != nullptr);
+                }
+                cur[i] = node;
+            }
+        }
+    }
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::prefetch(_Node const *node) {
+#if defined(__GNUC__)
+    __builtin_prefetch(node);
+#else
+    (void)node;
+#endif
+}
+
 template <class T, typename _Cmp>
 typename RBTree<T, _Cmp>::size_type RBTree<T, _Cmp>::count(
     const key_type &key) {
     size_type res = 0;
-    for (auto it = begin(); it != end(); it++) {
-        if (compare(*it, key) == compare(key, *it)) {
-            res++;
-        }
+    for (auto it = lower_bound(key), last = upper_bound(key); it != last; it++) {
+        res++;
     }
     return res;
 }
@@ -732,29 +1612,28 @@ template <class T, typename _Cmp>
 std::pair<typename RBTree<T, _Cmp>::iterator,
           typename RBTree<T, _Cmp>::iterator>
 RBTree<T, _Cmp>::equal_range(const key_type &key) {
-    iterator start = end();
-    iterator finish = end();
-    for (auto it = begin(); it != end(); it++) {
-        if (compare(*it, key) == compare(key, *it)) {
-            if (start == end()) {
-                start = it;
-            }
-            finish = it;
-        } else if (start != end()) {
-            break;
-        }
-    }
-    return std::make_pair(start, finish);
+    return std::make_pair(lower_bound(key), upper_bound(key));
 }
 
 template <class T, typename _Cmp>
 typename RBTree<T, _Cmp>::iterator RBTree<T, _Cmp>::lower_bound(
     const key_type &key) {
-    iterator res = begin();
-    for (auto it = begin(); it != end(); it++) {
-        if (compare(key, *it) == true || compare(*it, key) == false) {
-            res = it;
-            break;
+    return iterator(lower_bound_node(key));
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::lower_bound_node(
+    const key_type &key) {
+    /*  "node < key" is spelled so that it holds for both strict comparators
+     * and std::less_equal used by multiset  */
+    _Node *res = _end;
+    _Node *node = _head;
+    while (node != nullptr) {
+        if (compare(node->data, key) == true && compare(key, node->data) == false) {
+            node = node->right;
+        } else {
+            res = node;
+            node = node->left;
         }
     }
     return res;
@@ -763,14 +1642,152 @@ typename RBTree<T, _Cmp>::iterator RBTree<T, _Cmp>::lower_bound(
 template <class T, typename _Cmp>
 typename RBTree<T, _Cmp>::iterator RBTree<T, _Cmp>::upper_bound(
     const key_type &key) {
-    iterator res = begin();
-    for (auto it = begin(); it != end(); it++) {
-        if (compare(*it, key) == false && compare(key, *it) == true) {
-            res = it;
-            break;
+    _Node *res = _end;
+    _Node *node = _head;
+    while (node != nullptr) {
+        if (compare(node->data, key) == false && compare(key, node->data) == true) {
+            res = node;
+            node = node->left;
+        } else {
+            node = node->right;
         }
     }
-    return res;
+    return iterator(res);
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::leftmost() const {
+    _Node *first = _head;
+    if (first == nullptr) {
+        first = _end;
+    } else {
+        while (first->left != nullptr) {
+            first = first->left;
+        }
+    }
+    return first;
+}
+
+template <class T, typename _Cmp>
+typename RBTree<T, _Cmp>::_Node *RBTree<T, _Cmp>::rightmost() const {
+    _Node *last = _head;
+    if (last == nullptr) {
+        last = _end;
+    } else {
+        while (last->right != nullptr) {
+            last = last->right;
+        }
+    }
+    return last;
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::thread_all() {
+    /*  relinks the whole tree in one O(n) walk, for the operations that
+     * build a tree out of nodes from several places: copying, rebuilding
+     * and the set algebra  */
+#ifdef S21_RBTREE_THREADED
+    if (_end != nullptr) {
+        _Node *prev = _end;
+        for (_Node *node = leftmost(); node != _end; node = _Node::in_order_next(node)) {
+            node->prev = prev;
+            if (prev != _end) {
+                prev->next = node;
+            }
+            prev = node;
+        }
+        if (prev != _end) {
+            prev->next = _end;
+        }
+        _end->prev = prev;
+        _end->next = _end;
+    }
+#endif
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::thread_node(_Node *node) {
+    /*  a new leaf sits right before its parent when it is a left child and
+     * right after it otherwise  */
+#ifdef S21_RBTREE_THREADED
+    _Node *parent = node->parent;
+    _Node *before = node->is_left_child() ? parent->prev : parent;
+    _Node *after = node->is_left_child() ? parent : parent->next;
+    node->prev = before;
+    node->next = after;
+    if (before != _end) {
+        before->next = node;
+    }
+    after->prev = node;
+#else
+    (void)node;
+#endif
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::unthread_node(_Node *node) {
+#ifdef S21_RBTREE_THREADED
+    if (node->prev != _end) {
+        node->prev->next = node->next;
+    }
+    node->next->prev = node->prev;
+    node->prev = node->next = nullptr;
+#else
+    (void)node;
+#endif
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::split_threads(_Node *first, RBTree<T, _Cmp> &right) {
+    /*  a split cuts the list between first and the node before it, every
+     * other link stays valid in its half, so the threads are fixed in O(1)  */
+#ifdef S21_RBTREE_THREADED
+    _Node *before = first->prev;
+    _Node *last = _end->prev;
+    before->next = _end;
+    _end->prev = before;
+    first->prev = right._end;
+    last->next = right._end;
+    right._end->prev = last;
+    right._end->next = right._end;
+#else
+    (void)first;
+    (void)right;
+#endif
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::join_threads(_Node *pivot, RBTree<T, _Cmp> &other) {
+    /*  every key of other follows ours: pivot goes between our last node
+     * and other's first, other's last node then leads to our sentinel  */
+#ifdef S21_RBTREE_THREADED
+    _Node *last = _end->prev;
+    _Node *other_first = other.leftmost();
+    _Node *other_last = other._end->prev;
+    last->next = pivot;
+    pivot->prev = last;
+    if (other_first == other._end) {
+        pivot->next = _end;
+        _end->prev = pivot;
+    } else {
+        pivot->next = other_first;
+        other_first->prev = pivot;
+        other_last->next = _end;
+        _end->prev = other_last;
+    }
+#else
+    (void)pivot;
+    (void)other;
+#endif
+}
+
+template <class T, typename _Cmp>
+void RBTree<T, _Cmp>::reset_threads() {
+#ifdef S21_RBTREE_THREADED
+    if (_end != nullptr) {
+        _end->prev = _end->next = _end;
+    }
+#endif
 }
 
 template <class T, typename _Cmp>
@@ -0,0 +1,158 @@
+#ifndef SRC_WORKSTEALINGDEQUE_H_
+#define SRC_WORKSTEALINGDEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace s21 {
+/*  Chase-Lev deque: one owner thread pushes and pops at the bottom, any
+ * number of thieves steal from the top. only the last element is contended,
+ * owner and thieves settle it with one CAS on top. the ring grows when full,
+ * thieves may still read the old ring, so retired rings are kept until the
+ * deque is destroyed. algorithm and memory orders described here:
+ * https://fzn.fr/readings/ppopp13.pdf */
+template <class T>
+class WorkStealingDeque {
+ public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque holds trivially copyable values");
+
+    explicit WorkStealingDeque(size_type capacity = 64);
+    WorkStealingDeque(const WorkStealingDeque &d) = delete;
+    ~WorkStealingDeque();
+    WorkStealingDeque &operator=(const WorkStealingDeque &d) = delete;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    /*  owner side  */
+    void push(value_type value);
+    bool pop(value_type &value);
+
+    /*  thief side, fails when the deque is empty or another thread took the
+     * top element first  */
+    bool steal(value_type &value);
+
+ private:
+    struct _Ring {
+        std::int64_t mask;
+        std::atomic<T> *slots;
+        _Ring *retired;
+
+        explicit _Ring(std::int64_t capacity)
+            : mask(capacity - 1),
+              slots(new std::atomic<T>[static_cast<size_type>(capacity)]),
+              retired(nullptr) {}
+        ~_Ring() { delete[] slots; }
+        T get(std::int64_t i) const noexcept { return slots[i & mask].load(std::memory_order_relaxed); }
+        void put(std::int64_t i, T value) noexcept {
+            slots[i & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<std::int64_t> _top;
+    alignas(64) std::atomic<std::int64_t> _bottom;
+    std::atomic<_Ring *> _ring;
+
+    _Ring *_grow(_Ring *ring, std::int64_t bottom, std::int64_t top);
+};
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_type capacity) : _top(0), _bottom(0), _ring(nullptr) {
+    std::int64_t slots = 2;
+    while (static_cast<size_type>(slots) < capacity) {
+        slots <<= 1;
+    }
+    _ring.store(new _Ring(slots), std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+    _Ring *ring = _ring.load(std::memory_order_relaxed);
+    while (ring != nullptr) {
+        _Ring *retired = ring->retired;
+        delete ring;
+        ring = retired;
+    }
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::size_type WorkStealingDeque<T>::size() const noexcept {
+    std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    std::int64_t top = _top.load(std::memory_order_relaxed);
+    return (bottom > top) ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(value_type value) {
+    std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    std::int64_t top = _top.load(std::memory_order_acquire);
+    _Ring *ring = _ring.load(std::memory_order_relaxed);
+    if (bottom - top > ring->mask) {
+        ring = _grow(ring, bottom, top);
+    }
+    ring->put(bottom, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(value_type &value) {
+    std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _Ring *ring = _ring.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = _top.load(std::memory_order_relaxed);
+    bool taken = false;
+    if (top <= bottom) {
+        value = ring->get(bottom);
+        taken = true;
+        if (top == bottom) {
+            /*  last element, race the thieves for it  */
+            taken = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                 std::memory_order_relaxed);
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+    } else {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return taken;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(value_type &value) {
+    std::int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom = _bottom.load(std::memory_order_acquire);
+    bool taken = false;
+    if (top < bottom) {
+        _Ring *ring = _ring.load(std::memory_order_acquire);
+        value = ring->get(top);
+        taken = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+    }
+    return taken;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::_Ring *WorkStealingDeque<T>::_grow(_Ring *ring, std::int64_t bottom,
+                                                                  std::int64_t top) {
+    _Ring *grown = new _Ring(2 * (ring->mask + 1));
+    for (std::int64_t i = top; i < bottom; ++i) {
+        grown->put(i, ring->get(i));
+    }
+    grown->retired = ring;
+    _ring.store(grown, std::memory_order_release);
+    return grown;
+}
+}  // namespace s21
+
+#endif  // SRC_WORKSTEALINGDEQUE_H_
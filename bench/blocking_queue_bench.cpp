@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_blocking_queue.h"
+#include "s21_queue.h"
+
+/*  one pipeline stage: a producer thread hands kRecords records to a
+ * consumer thread, state.range(0) records per push and per pop  */
+
+static std::int64_t const kRecords = 1 << 20;
+
+static void BM_blocking_queue_batch(benchmark::State &state) {
+    auto batch = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        s21::blocking_queue<std::int64_t> q(1024);
+        std::thread producer([&q, batch]() {
+            std::vector<std::int64_t> records(batch);
+            for (std::int64_t i = 0; i < kRecords; i += static_cast<std::int64_t>(batch)) {
+                q.push_batch(records.begin(), records.end());
+            }
+            q.close();
+        });
+        std::vector<std::int64_t> records;
+        records.reserve(batch);
+        std::int64_t received = 0;
+        std::size_t taken = 0;
+        while ((taken = q.pop_batch(std::back_inserter(records), batch)) > 0) {
+            received += static_cast<std::int64_t>(taken);
+            records.clear();
+        }
+        producer.join();
+        benchmark::DoNotOptimize(received);
+    }
+    state.SetItemsProcessed(state.iterations() * kRecords);
+}
+
+struct locked_queue {
+    s21::queue<std::int64_t> q;
+    std::mutex lock;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+};
+
+static void BM_mutex_queue_per_record(benchmark::State &state) {
+    for (auto _ : state) {
+        locked_queue q;
+        std::thread producer([&q]() {
+            for (std::int64_t i = 0; i < kRecords; ++i) {
+                std::unique_lock<std::mutex> lock(q.lock);
+                q.not_full.wait(lock, [&q]() { return q.q.size() < 1024; });
+                q.q.push(i);
+                q.not_empty.notify_one();
+            }
+        });
+        for (std::int64_t i = 0; i < kRecords; ++i) {
+            std::unique_lock<std::mutex> lock(q.lock);
+            q.not_empty.wait(lock, [&q]() { return !q.q.empty(); });
+            benchmark::DoNotOptimize(q.q.front());
+            q.q.pop();
+            q.not_full.notify_one();
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kRecords);
+}
+
+BENCHMARK(BM_blocking_queue_batch)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->ArgName("batch")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_mutex_queue_per_record)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <shared_mutex>
+
+#include "s21_concurrent_map.h"
+#include "s21_map.h"
+
+/*  every thread runs the same mix: 99% lookups and 1% insert_or_assign
+ * on a map of 100000 keys  */
+
+static int const kKeys = 100000;
+
+static unsigned next_random(unsigned &state) {
+    state = state * 1103515245u + 12345u;
+    return state >> 8;
+}
+
+static s21::concurrent_map<int, int> &shared_concurrent_map() {
+    static s21::concurrent_map<int, int> m;
+    static std::once_flag filled;
+    std::call_once(filled, []() {
+        for (int i = 0; i < kKeys; ++i) {
+            m.insert(i, i);
+        }
+    });
+    return m;
+}
+
+static void BM_concurrent_map_read_mostly(benchmark::State &state) {
+    auto &m = shared_concurrent_map();
+    unsigned seed = static_cast<unsigned>(state.thread_index()) + 1;
+    for (auto _ : state) {
+        unsigned r = next_random(seed);
+        int key = static_cast<int>(r % kKeys);
+        if (r % 100 == 0) {
+            m.insert_or_assign(key, key);
+        } else {
+            benchmark::DoNotOptimize(m.contains(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+struct locked_map {
+    s21::map<int, int> m;
+    std::shared_mutex lock;
+};
+
+static locked_map &shared_locked_map() {
+    static locked_map m;
+    static std::once_flag filled;
+    std::call_once(filled, []() {
+        for (int i = 0; i < kKeys; ++i) {
+            m.m.insert(i, i);
+        }
+    });
+    return m;
+}
+
+static void BM_shared_mutex_map_read_mostly(benchmark::State &state) {
+    auto &m = shared_locked_map();
+    unsigned seed = static_cast<unsigned>(state.thread_index()) + 1;
+    for (auto _ : state) {
+        unsigned r = next_random(seed);
+        int key = static_cast<int>(r % kKeys);
+        if (r % 100 == 0) {
+            std::unique_lock<std::shared_mutex> lock(m.lock);
+            m.m.insert_or_assign(key, key);
+        } else {
+            std::shared_lock<std::shared_mutex> lock(m.lock);
+            benchmark::DoNotOptimize(m.m.contains(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_concurrent_map_read_mostly)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_shared_mutex_map_read_mostly)->ThreadRange(1, 64)->UseRealTime();
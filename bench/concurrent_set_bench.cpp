@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "s21_concurrent_set.h"
+#include "s21_set.h"
+
+/*  mixed workloads on 100000 keys, state.range(0) is the percentage of
+ * updates (split evenly between insert and erase), the rest are lookups
+ * and every 64th operation is a 16 element range scan  */
+
+static int const kKeys = 100000;
+
+static unsigned next_random(unsigned &state) {
+    state = state * 1103515245u + 12345u;
+    return state >> 8;
+}
+
+static s21::concurrent_set<int> &shared_concurrent_set() {
+    static s21::concurrent_set<int> s;
+    static std::once_flag filled;
+    std::call_once(filled, []() {
+        for (int i = 0; i < kKeys; i += 2) {
+            s.insert(i);
+        }
+    });
+    return s;
+}
+
+static void BM_concurrent_set_mixed(benchmark::State &state) {
+    auto &s = shared_concurrent_set();
+    unsigned updates = static_cast<unsigned>(state.range(0));
+    unsigned seed = static_cast<unsigned>(state.thread_index()) + 1;
+    for (auto _ : state) {
+        unsigned r = next_random(seed);
+        int key = static_cast<int>(r % kKeys);
+        if ((r >> 20) % 64 == 0) {
+            int count = 0;
+            for (auto it = s.lower_bound(key); it != s.end() && count < 16; ++it) {
+                benchmark::DoNotOptimize(*it);
+                ++count;
+            }
+        } else if (r % 100 < updates / 2) {
+            s.insert(key);
+        } else if (r % 100 < updates) {
+            s.erase(key);
+        } else {
+            benchmark::DoNotOptimize(s.contains(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+struct locked_set {
+    s21::set<int> s;
+    std::mutex lock;
+};
+
+static locked_set &shared_locked_set() {
+    static locked_set s;
+    static std::once_flag filled;
+    std::call_once(filled, []() {
+        for (int i = 0; i < kKeys; i += 2) {
+            s.s.insert(i);
+        }
+    });
+    return s;
+}
+
+static void BM_mutex_set_mixed(benchmark::State &state) {
+    auto &s = shared_locked_set();
+    unsigned updates = static_cast<unsigned>(state.range(0));
+    unsigned seed = static_cast<unsigned>(state.thread_index()) + 1;
+    for (auto _ : state) {
+        unsigned r = next_random(seed);
+        int key = static_cast<int>(r % kKeys);
+        std::lock_guard<std::mutex> lock(s.lock);
+        if ((r >> 20) % 64 == 0) {
+            int count = 0;
+            for (auto it = s.s.lower_bound(key); it != s.s.end() && count < 16; ++it) {
+                benchmark::DoNotOptimize(*it);
+                ++count;
+            }
+        } else if (r % 100 < updates / 2) {
+            s.s.insert(key);
+        } else if (r % 100 < updates) {
+            s.s.erase(key);
+        } else {
+            benchmark::DoNotOptimize(s.s.contains(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_concurrent_set_mixed)->Arg(10)->Arg(50)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_mutex_set_mixed)->Arg(10)->Arg(50)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "s21_concurrent_stack.h"
+#include "s21_stack.h"
+
+/*  every thread pushes a buffer and pops one back, like threads sharing a
+ * free list of reusable buffers. all threads hit the same stack  */
+
+template <bool Elimination>
+static void BM_concurrent_stack_push_pop(benchmark::State &state) {
+    static s21::concurrent_stack<int, Elimination> s;
+    int value = state.thread_index();
+    for (auto _ : state) {
+        s.push(value);
+        benchmark::DoNotOptimize(s.try_pop(value));
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+}
+
+static void BM_mutex_stack_push_pop(benchmark::State &state) {
+    static s21::stack<int> s;
+    static std::mutex lock;
+    int value = state.thread_index();
+    for (auto _ : state) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            s.push(value);
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        value = s.top();
+        s.pop();
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_concurrent_stack_push_pop, true)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_concurrent_stack_push_pop, false)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_mutex_stack_push_pop)->ThreadRange(1, 64)->UseRealTime();
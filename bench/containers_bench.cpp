@@ -0,0 +1,442 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <utility>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+/*  insert, erase, find, iterate, sort, copy and destroy for every core
+ * container next to its std:: counterpart, over 10 to 10^7 elements.
+ * items_per_second counts elements, so the rows of one operation compare
+ * directly across containers and sizes. `make bench` writes the results
+ * as JSON for diffing between releases  */
+
+static std::vector<int> make_keys(std::size_t n) {
+    std::vector<int> keys(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = static_cast<int>(i);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(1));
+    return keys;
+}
+
+static void sizes(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(10, 10000000)->ArgName("n");
+}
+
+/*  how each family of containers takes and gives back elements  */
+
+struct sequence_ops {
+    template <class C>
+    static void insert(C &c, std::vector<int> const &keys) {
+        for (int key : keys) {
+            c.push_back(key);
+        }
+    }
+    template <class C>
+    static void erase(C &c, std::vector<int> const &) {
+        while (!c.empty()) {
+            c.pop_back();
+        }
+    }
+    template <class C>
+    static bool find(C &c, std::vector<int> const &) {
+        /*  a missing value, so the whole sequence is scanned  */
+        for (auto it = c.begin(); it != c.end(); ++it) {
+            if (*it == -1) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+struct vector_ops : sequence_ops {
+    template <class C>
+    static void sort(C &c) {
+        std::sort(c.data(), c.data() + c.size());
+    }
+};
+
+struct list_ops : sequence_ops {
+    template <class C>
+    static void sort(C &c) {
+        c.sort();
+    }
+};
+
+template <class C>
+static bool has(C &c, int key) {
+    return c.find(key) != c.end();
+}
+
+template <class K, class V>
+static bool has(s21::map<K, V> &c, int key) {
+    return c.contains(key);
+}
+
+struct set_ops {
+    template <class C>
+    static void insert(C &c, std::vector<int> const &keys) {
+        for (int key : keys) {
+            c.insert(key);
+        }
+    }
+    template <class C>
+    static void erase(C &c, std::vector<int> const &keys) {
+        for (int key : keys) {
+            c.erase(key);
+        }
+    }
+    template <class C>
+    static bool find(C &c, std::vector<int> const &keys) {
+        bool found = true;
+        for (int key : keys) {
+            found &= has(c, key);
+        }
+        return found;
+    }
+};
+
+struct map_ops : set_ops {
+    template <class C>
+    static void insert(C &c, std::vector<int> const &keys) {
+        for (int key : keys) {
+            c.insert(std::make_pair(key, key));
+        }
+    }
+};
+
+struct adaptor_ops {
+    template <class C>
+    static void insert(C &c, std::vector<int> const &keys) {
+        for (int key : keys) {
+            c.push(key);
+        }
+    }
+    template <class C>
+    static void erase(C &c, std::vector<int> const &) {
+        while (!c.empty()) {
+            c.pop();
+        }
+    }
+};
+
+template <class C>
+static long sum(C const &c) {
+    long total = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) {
+        total += *it;
+    }
+    return total;
+}
+
+template <class K, class V>
+static long sum(s21::map<K, V> const &c) {
+    long total = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) {
+        total += (*it).second;
+    }
+    return total;
+}
+
+template <class K, class V>
+static long sum(std::map<K, V> const &c) {
+    long total = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) {
+        total += it->second;
+    }
+    return total;
+}
+
+/*  the operations, timed without building or tearing down the containers
+ * they need  */
+
+template <class C, class Ops>
+static void BM_insert(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto c = std::make_unique<C>();
+        Ops::insert(*c, keys);
+        state.PauseTiming();
+        c.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C, class Ops>
+static void BM_erase(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto c = std::make_unique<C>();
+        Ops::insert(*c, keys);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(2));
+        state.ResumeTiming();
+        Ops::erase(*c, keys);
+        benchmark::DoNotOptimize(c->empty());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C, class Ops>
+static void BM_find(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    C c;
+    Ops::insert(c, keys);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Ops::find(c, keys));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C, class Ops>
+static void BM_iterate(benchmark::State &state) {
+    C c;
+    Ops::insert(c, make_keys(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(c));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C, class Ops>
+static void BM_sort(benchmark::State &state) {
+    C source;
+    Ops::insert(source, make_keys(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto c = std::make_unique<C>(source);
+        state.ResumeTiming();
+        Ops::sort(*c);
+        state.PauseTiming();
+        c.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C, class Ops>
+static void BM_copy(benchmark::State &state) {
+    C source;
+    Ops::insert(source, make_keys(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        auto c = std::make_unique<C>(source);
+        benchmark::DoNotOptimize(c.get());
+        state.PauseTiming();
+        c.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C, class Ops>
+static void BM_destroy(benchmark::State &state) {
+    C source;
+    Ops::insert(source, make_keys(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto c = std::make_unique<C>(source);
+        state.ResumeTiming();
+        c.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*  a queue in steady state: n messages in flight, each iteration pushes
+ * one at the back and pops one from the front  */
+template <class C, class Ops>
+static void BM_push_pop(benchmark::State &state) {
+    C c;
+    Ops::insert(c, make_keys(static_cast<std::size_t>(state.range(0))));
+    int value = 0;
+    for (auto _ : state) {
+        c.push_back(value++);
+        c.pop_front();
+    }
+    benchmark::DoNotOptimize(c.front());
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void queue_lengths(benchmark::internal::Benchmark *b) {
+    b->Arg(16)->Arg(1024)->Arg(65536)->ArgName("n");
+}
+
+/*  array has its size in the type, so it runs at fixed sizes with the
+ * elements on the heap for the big ones  */
+
+template <class A>
+static void BM_array_fill(benchmark::State &state) {
+    auto a = std::make_unique<A>();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a->size(); ++i) {
+            (*a)[i] = static_cast<int>(i);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(a->size()));
+}
+
+template <class A>
+static void BM_array_iterate(benchmark::State &state) {
+    auto a = std::make_unique<A>();
+    auto keys = make_keys(a->size());
+    std::copy(keys.begin(), keys.end(), a->data());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*a));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(a->size()));
+}
+
+template <class A>
+static void BM_array_find(benchmark::State &state) {
+    auto a = std::make_unique<A>();
+    auto keys = make_keys(a->size());
+    std::copy(keys.begin(), keys.end(), a->data());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sequence_ops::find(*a, keys));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(a->size()));
+}
+
+template <class A>
+static void BM_array_sort(benchmark::State &state) {
+    auto source = std::make_unique<A>();
+    auto keys = make_keys(source->size());
+    std::copy(keys.begin(), keys.end(), source->data());
+    auto a = std::make_unique<A>();
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(source->data(), source->data() + source->size(), a->data());
+        state.ResumeTiming();
+        std::sort(a->data(), a->data() + a->size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(a->size()));
+}
+
+template <class A>
+static void BM_array_copy(benchmark::State &state) {
+    auto source = std::make_unique<A>();
+    for (auto _ : state) {
+        auto a = std::make_unique<A>(*source);
+        benchmark::DoNotOptimize(a.get());
+        state.PauseTiming();
+        a.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(source->size()));
+}
+
+using s21_vector = s21::vector<int>;
+using std_vector = std::vector<int>;
+using s21_list = s21::list<int>;
+using std_list = std::list<int>;
+using s21_unrolled_list = s21::unrolled_list<int>;
+
+/*  s21::list with its node cache turned off, one malloc and free per
+ * message like std::list  */
+struct s21_uncached_list : s21::list<int> {
+    s21_uncached_list() { set_cache_limit(0); }
+};
+using s21_set = s21::set<int>;
+using std_set = std::set<int>;
+using s21_multiset = s21::multiset<int>;
+using std_multiset = std::multiset<int>;
+using s21_map = s21::map<int, int>;
+using std_map = std::map<int, int>;
+using s21_queue = s21::queue<int>;
+using std_queue = std::queue<int>;
+using s21_stack = s21::stack<int>;
+using std_stack = std::stack<int>;
+
+#define S21_BENCH(op, container, ops)                           \
+    BENCHMARK_TEMPLATE(op, s21_##container, ops)->Apply(sizes); \
+    BENCHMARK_TEMPLATE(op, std_##container, ops)->Apply(sizes)
+
+#define S21_BENCH_ARRAY(op)                            \
+    BENCHMARK_TEMPLATE(op, s21::array<int, 10>);       \
+    BENCHMARK_TEMPLATE(op, std::array<int, 10>);       \
+    BENCHMARK_TEMPLATE(op, s21::array<int, 1000>);     \
+    BENCHMARK_TEMPLATE(op, std::array<int, 1000>);     \
+    BENCHMARK_TEMPLATE(op, s21::array<int, 100000>);   \
+    BENCHMARK_TEMPLATE(op, std::array<int, 100000>);   \
+    BENCHMARK_TEMPLATE(op, s21::array<int, 10000000>); \
+    BENCHMARK_TEMPLATE(op, std::array<int, 10000000>)
+
+S21_BENCH(BM_insert, vector, vector_ops);
+S21_BENCH(BM_erase, vector, vector_ops);
+S21_BENCH(BM_find, vector, vector_ops);
+S21_BENCH(BM_iterate, vector, vector_ops);
+S21_BENCH(BM_sort, vector, vector_ops);
+S21_BENCH(BM_copy, vector, vector_ops);
+S21_BENCH(BM_destroy, vector, vector_ops);
+
+S21_BENCH(BM_insert, list, list_ops);
+S21_BENCH(BM_erase, list, list_ops);
+S21_BENCH(BM_find, list, list_ops);
+S21_BENCH(BM_iterate, list, list_ops);
+S21_BENCH(BM_sort, list, list_ops);
+S21_BENCH(BM_copy, list, list_ops);
+S21_BENCH(BM_destroy, list, list_ops);
+
+BENCHMARK_TEMPLATE(BM_push_pop, s21_list, list_ops)->Apply(queue_lengths);
+BENCHMARK_TEMPLATE(BM_push_pop, s21_uncached_list, list_ops)->Apply(queue_lengths);
+BENCHMARK_TEMPLATE(BM_push_pop, std_list, list_ops)->Apply(queue_lengths);
+
+/*  no std:: counterpart, the list and vector rows above are the ones to
+ * compare against  */
+BENCHMARK_TEMPLATE(BM_insert, s21_unrolled_list, sequence_ops)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_erase, s21_unrolled_list, sequence_ops)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_find, s21_unrolled_list, sequence_ops)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_iterate, s21_unrolled_list, sequence_ops)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_copy, s21_unrolled_list, sequence_ops)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_destroy, s21_unrolled_list, sequence_ops)->Apply(sizes);
+
+S21_BENCH(BM_insert, set, set_ops);
+S21_BENCH(BM_erase, set, set_ops);
+S21_BENCH(BM_find, set, set_ops);
+S21_BENCH(BM_iterate, set, set_ops);
+S21_BENCH(BM_copy, set, set_ops);
+S21_BENCH(BM_destroy, set, set_ops);
+
+S21_BENCH(BM_insert, multiset, set_ops);
+S21_BENCH(BM_erase, multiset, set_ops);
+S21_BENCH(BM_find, multiset, set_ops);
+S21_BENCH(BM_iterate, multiset, set_ops);
+S21_BENCH(BM_copy, multiset, set_ops);
+S21_BENCH(BM_destroy, multiset, set_ops);
+
+S21_BENCH(BM_insert, map, map_ops);
+S21_BENCH(BM_erase, map, map_ops);
+S21_BENCH(BM_find, map, map_ops);
+S21_BENCH(BM_iterate, map, map_ops);
+S21_BENCH(BM_copy, map, map_ops);
+S21_BENCH(BM_destroy, map, map_ops);
+
+S21_BENCH(BM_insert, queue, adaptor_ops);
+S21_BENCH(BM_erase, queue, adaptor_ops);
+S21_BENCH(BM_copy, queue, adaptor_ops);
+S21_BENCH(BM_destroy, queue, adaptor_ops);
+
+S21_BENCH(BM_insert, stack, adaptor_ops);
+S21_BENCH(BM_erase, stack, adaptor_ops);
+S21_BENCH(BM_copy, stack, adaptor_ops);
+S21_BENCH(BM_destroy, stack, adaptor_ops);
+
+S21_BENCH_ARRAY(BM_array_fill);
+S21_BENCH_ARRAY(BM_array_iterate);
+S21_BENCH_ARRAY(BM_array_find);
+S21_BENCH_ARRAY(BM_array_sort);
+S21_BENCH_ARRAY(BM_array_copy);
@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "s21_indexed_priority_queue.h"
+#include "s21_multiset.h"
+#include "s21_priority_queue.h"
+
+/*  single-source shortest paths on a road-like graph: a side x side grid
+ * of streets with random lengths, plus highways every 32 blocks that are
+ * three times faster. peak_queue is the largest number of queued entries,
+ * which grows with stale duplicates when there is no decrease-key  */
+
+struct road_graph {
+    std::vector<std::size_t> first;
+    std::vector<std::size_t> target;
+    std::vector<std::int64_t> length;
+
+    std::size_t size() const { return first.size() - 1; }
+};
+
+static road_graph make_roads(std::size_t side) {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<std::int64_t> street(10, 100);
+    std::vector<std::vector<std::pair<std::size_t, std::int64_t>>> edges(side * side);
+    auto connect = [&edges](std::size_t a, std::size_t b, std::int64_t l) {
+        edges[a].emplace_back(b, l);
+        edges[b].emplace_back(a, l);
+    };
+    for (std::size_t y = 0; y < side; ++y) {
+        for (std::size_t x = 0; x < side; ++x) {
+            std::size_t v = y * side + x;
+            if (x + 1 < side) {
+                connect(v, v + 1, (y % 32 == 0) ? 15 : street(gen));
+            }
+            if (y + 1 < side) {
+                connect(v, v + side, (x % 32 == 0) ? 15 : street(gen));
+            }
+        }
+    }
+    road_graph g;
+    g.first.push_back(0);
+    for (auto &out : edges) {
+        for (auto &edge : out) {
+            g.target.push_back(edge.first);
+            g.length.push_back(edge.second);
+        }
+        g.first.push_back(g.target.size());
+    }
+    return g;
+}
+
+static road_graph const &roads(std::size_t side) {
+    static std::size_t built = 0;
+    static road_graph g;
+    if (built != side) {
+        g = make_roads(side);
+        built = side;
+    }
+    return g;
+}
+
+static std::int64_t const kUnreached = INT64_MAX;
+
+template <std::size_t Arity>
+static std::int64_t dijkstra_indexed(road_graph const &g, std::size_t &peak) {
+    std::vector<std::int64_t> dist(g.size(), kUnreached);
+    s21::indexed_priority_queue<std::int64_t, std::less<std::int64_t>, Arity> q(g.size());
+    dist[0] = 0;
+    q.push(0, 0);
+    while (!q.empty()) {
+        std::size_t v = q.top().first;
+        q.pop();
+        for (std::size_t e = g.first[v]; e < g.first[v + 1]; ++e) {
+            std::size_t w = g.target[e];
+            std::int64_t d = dist[v] + g.length[e];
+            if (d < dist[w]) {
+                if (q.contains(w)) {
+                    q.decrease_key(w, d);
+                } else {
+                    q.push(w, d);
+                }
+                dist[w] = d;
+            }
+        }
+        peak = (q.size() > peak) ? q.size() : peak;
+    }
+    return dist.back();
+}
+
+template <class Queue>
+static std::int64_t dijkstra_lazy(road_graph const &g, std::size_t &peak, Queue &q) {
+    std::vector<std::int64_t> dist(g.size(), kUnreached);
+    dist[0] = 0;
+    q.push(std::make_pair(std::int64_t(0), std::size_t(0)));
+    while (!q.empty()) {
+        std::pair<std::int64_t, std::size_t> top = q.pop();
+        std::size_t v = top.second;
+        if (top.first > dist[v]) {
+            continue;
+        }
+        for (std::size_t e = g.first[v]; e < g.first[v + 1]; ++e) {
+            std::size_t w = g.target[e];
+            std::int64_t d = dist[v] + g.length[e];
+            if (d < dist[w]) {
+                q.push(std::make_pair(d, w));
+                dist[w] = d;
+            }
+        }
+        peak = (q.size() > peak) ? q.size() : peak;
+    }
+    return dist.back();
+}
+
+using entry = std::pair<std::int64_t, std::size_t>;
+
+struct multiset_queue {
+    s21::multiset<entry> entries;
+
+    bool empty() const { return entries.empty(); }
+    std::size_t size() const { return entries.size(); }
+    void push(entry const &e) { entries.insert(e); }
+    entry pop() {
+        auto first = entries.begin();
+        entry e = *first;
+        entries.erase(first);
+        return e;
+    }
+};
+
+struct heap_queue {
+    s21::priority_queue<entry, s21::vector<entry>, std::greater<entry>, 4> entries;
+
+    bool empty() const { return entries.empty(); }
+    std::size_t size() const { return entries.size(); }
+    void push(entry const &e) { entries.push(e); }
+    entry pop() {
+        entry e = entries.top();
+        entries.pop();
+        return e;
+    }
+};
+
+template <class Queue>
+static void BM_dijkstra_lazy(benchmark::State &state) {
+    auto const &g = roads(static_cast<std::size_t>(state.range(0)));
+    std::size_t peak = 0;
+    for (auto _ : state) {
+        Queue q;
+        benchmark::DoNotOptimize(dijkstra_lazy(g, peak, q));
+    }
+    state.counters["peak_queue"] = static_cast<double>(peak);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g.size()));
+}
+
+template <std::size_t Arity>
+static void BM_dijkstra_indexed(benchmark::State &state) {
+    auto const &g = roads(static_cast<std::size_t>(state.range(0)));
+    std::size_t peak = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dijkstra_indexed<Arity>(g, peak));
+    }
+    state.counters["peak_queue"] = static_cast<double>(peak);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_dijkstra_lazy, multiset_queue)->Arg(256)->Arg(1024)->ArgName("side")->Unit(
+    benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_dijkstra_lazy, heap_queue)->Arg(256)->Arg(1024)->ArgName("side")->Unit(
+    benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_dijkstra_indexed, 2)->Arg(256)->Arg(1024)->ArgName("side")->Unit(
+    benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_dijkstra_indexed, 4)->Arg(256)->Arg(1024)->ArgName("side")->Unit(
+    benchmark::kMillisecond);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ForkJoinPool.h"
+
+static long serial_fib(int n) { return (n < 2) ? n : serial_fib(n - 1) + serial_fib(n - 2); }
+
+static long pool_fib(s21::ForkJoinPool &pool, int n) {
+    if (n < 20) {
+        return serial_fib(n);
+    }
+    long a = 0;
+    long b = 0;
+    pool.invoke([&]() { a = pool_fib(pool, n - 1); }, [&]() { b = pool_fib(pool, n - 2); });
+    return a + b;
+}
+
+static void pool_sort(s21::ForkJoinPool &pool, int *first, int *last) {
+    if (last - first < 16384) {
+        std::sort(first, last);
+        return;
+    }
+    int *middle = first + (last - first) / 2;
+    pool.invoke([&]() { pool_sort(pool, first, middle); }, [&]() { pool_sort(pool, middle, last); });
+    std::inplace_merge(first, middle, last);
+}
+
+static std::vector<int> make_input(std::size_t n) {
+    std::mt19937 gen(1);
+    std::vector<int> v(n);
+    for (auto &x : v) {
+        x = static_cast<int>(gen());
+    }
+    return v;
+}
+
+static void BM_serial_fib(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serial_fib(static_cast<int>(state.range(0))));
+    }
+}
+
+static void BM_fork_join_fib(benchmark::State &state) {
+    s21::ForkJoinPool pool(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pool_fib(pool, static_cast<int>(state.range(0))));
+    }
+}
+
+static void BM_serial_sort(benchmark::State &state) {
+    auto input = make_input(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = input;
+        state.ResumeTiming();
+        std::sort(v.begin(), v.end());
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_fork_join_sort(benchmark::State &state) {
+    s21::ForkJoinPool pool(static_cast<std::size_t>(state.range(1)));
+    auto input = make_input(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = input;
+        state.ResumeTiming();
+        pool_sort(pool, v.data(), v.data() + v.size());
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void thread_sweep(benchmark::internal::Benchmark *b, int64_t n) {
+    auto cores = static_cast<int64_t>(std::thread::hardware_concurrency());
+    for (int64_t threads = 1; threads <= cores; threads *= 2) {
+        b->Args({n, threads});
+    }
+    if ((cores & (cores - 1)) != 0) {
+        b->Args({n, cores});
+    }
+    b->ArgNames({"n", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_serial_fib)->Arg(32)->ArgName("n")->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_fork_join_fib)->Apply([](benchmark::internal::Benchmark *b) { thread_sweep(b, 32); });
+BENCHMARK(BM_serial_sort)->Arg(1 << 22)->ArgName("n")->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_fork_join_sort)->Apply([](benchmark::internal::Benchmark *b) { thread_sweep(b, 1 << 22); });
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "s21_set.h"
+
+static std::vector<int> make_keys(std::size_t n) {
+    std::vector<int> keys(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = static_cast<int>(2 * i);
+    }
+    return keys;
+}
+
+static std::vector<int> make_queries(std::size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(2 * n));
+    std::vector<int> queries(1 << 16);
+    for (auto &q : queries) {
+        q = dist(gen);
+    }
+    return queries;
+}
+
+static void BM_frozen_set_contains(benchmark::State &state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto keys = make_keys(n);
+    auto queries = make_queries(n);
+    s21::frozen_set<int> s(keys.begin(), keys.end());
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(s.contains(queries[i++ & (queries.size() - 1)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_set_contains(benchmark::State &state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto queries = make_queries(n);
+    s21::set<int> s;
+    for (auto key : make_keys(n)) {
+        s.insert(key);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(s.contains(queries[i++ & (queries.size() - 1)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_std_binary_search(benchmark::State &state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto keys = make_keys(n);
+    auto queries = make_queries(n);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::binary_search(keys.begin(), keys.end(), queries[i++ & (queries.size() - 1)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_frozen_set_contains)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_set_contains)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_std_binary_search)->RangeMultiplier(10)->Range(1000, 10000000);
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "s21_set.h"
+
+/*  membership tests of a batch of random probes, half of them present, in
+ * an s21::set of n elements: a loop of contains() next to contains_many()
+ * with 1 to 32 interleaved descents. items_per_second counts probes  */
+
+static std::size_t const kProbes = 1 << 16;
+
+/*  the even numbers below 2n, built once per size and kept for every
+ * benchmark family  */
+static s21::set<int> &lookup_set(std::size_t n) {
+    static std::map<std::size_t, std::unique_ptr<s21::set<int>>> built;
+    auto &s = built[n];
+    if (s == nullptr) {
+        std::vector<int> keys(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = static_cast<int>(2 * i);
+        }
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(1));
+        s = std::make_unique<s21::set<int>>();
+        for (int key : keys) {
+            s->insert(key);
+        }
+    }
+    return *s;
+}
+
+static std::vector<int> make_probes(std::size_t n) {
+    std::mt19937 gen(2);
+    std::uniform_int_distribution<std::size_t> pick(0, 2 * n - 1);
+    std::vector<int> probes(kProbes);
+    for (int &probe : probes) {
+        probe = static_cast<int>(pick(gen));
+    }
+    return probes;
+}
+
+static void BM_contains_loop(benchmark::State &state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto &s = lookup_set(n);
+    auto probes = make_probes(n);
+    std::unique_ptr<bool[]> out(new bool[kProbes]);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kProbes; ++i) {
+            out[i] = s.contains(probes[i]);
+        }
+        benchmark::DoNotOptimize(out.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kProbes));
+}
+
+template <std::size_t Lanes>
+static void BM_contains_many(benchmark::State &state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto &s = lookup_set(n);
+    auto probes = make_probes(n);
+    std::unique_ptr<bool[]> out(new bool[kProbes]);
+    for (auto _ : state) {
+        s.contains_many<Lanes>(probes.data(), kProbes, out.get());
+        benchmark::DoNotOptimize(out.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kProbes));
+}
+
+static void lookup_sizes(benchmark::internal::Benchmark *b) {
+    b->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 21)->ArgName("n");
+}
+
+BENCHMARK(BM_contains_loop)->Apply(lookup_sizes);
+BENCHMARK_TEMPLATE(BM_contains_many, 1)->Apply(lookup_sizes);
+BENCHMARK_TEMPLATE(BM_contains_many, 4)->Apply(lookup_sizes);
+BENCHMARK_TEMPLATE(BM_contains_many, 8)->Apply(lookup_sizes);
+BENCHMARK_TEMPLATE(BM_contains_many, 16)->Apply(lookup_sizes);
+BENCHMARK_TEMPLATE(BM_contains_many, 32)->Apply(lookup_sizes);
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_mpmc_queue.h"
+#include "s21_queue.h"
+
+/*  state.range(0) producers hand kMessages values in total to
+ * state.range(1) consumers through blocking push and pop  */
+
+static std::int64_t const kMessages = 1 << 18;
+
+static void producers_consumers(benchmark::internal::Benchmark *b) {
+    for (std::int64_t producers : {1, 4, 16, 32}) {
+        for (std::int64_t consumers : {1, 4, 16, 32}) {
+            b->Args({producers, consumers});
+        }
+    }
+    b->ArgNames({"producers", "consumers"})->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+template <class Push, class Pop>
+static void run_stage(benchmark::State &state, Push push, Pop pop) {
+    auto producers = state.range(0);
+    auto consumers = state.range(1);
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (std::int64_t p = 0; p < producers; ++p) {
+            std::int64_t count = kMessages / producers + (p < kMessages % producers ? 1 : 0);
+            threads.emplace_back([push, count]() {
+                for (std::int64_t i = 0; i < count; ++i) {
+                    push(i);
+                }
+            });
+        }
+        for (std::int64_t c = 0; c < consumers; ++c) {
+            std::int64_t count = kMessages / consumers + (c < kMessages % consumers ? 1 : 0);
+            threads.emplace_back([pop, count]() {
+                for (std::int64_t i = 0; i < count; ++i) {
+                    benchmark::DoNotOptimize(pop());
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kMessages);
+}
+
+static void BM_mpmc_queue(benchmark::State &state) {
+    s21::mpmc_queue<std::int64_t> q(1024);
+    run_stage(
+        state, [&q](std::int64_t value) { q.push(value); },
+        [&q]() {
+            std::int64_t value = 0;
+            q.pop(value);
+            return value;
+        });
+}
+
+struct locked_queue {
+    s21::queue<std::int64_t> q;
+    std::mutex lock;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+};
+
+static void BM_mutex_queue(benchmark::State &state) {
+    locked_queue q;
+    run_stage(
+        state,
+        [&q](std::int64_t value) {
+            std::unique_lock<std::mutex> lock(q.lock);
+            q.not_full.wait(lock, [&q]() { return q.q.size() < 1024; });
+            q.q.push(value);
+            q.not_empty.notify_one();
+        },
+        [&q]() {
+            std::unique_lock<std::mutex> lock(q.lock);
+            q.not_empty.wait(lock, [&q]() { return !q.q.empty(); });
+            std::int64_t value = q.q.front();
+            q.q.pop();
+            q.not_full.notify_one();
+            return value;
+        });
+}
+
+BENCHMARK(BM_mpmc_queue)->Apply(producers_consumers);
+BENCHMARK(BM_mutex_queue)->Apply(producers_consumers);
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_map.h"
+#include "s21_persistent_map.h"
+
+/*  one update that keeps the previous version readable: a full copy of
+ * s21::map against a path-copying persistent_map update  */
+
+static void BM_map_copy_update(benchmark::State &state) {
+    int n = static_cast<int>(state.range(0));
+    s21::map<int, int> current;
+    for (int i = 0; i < n; ++i) {
+        current.insert(i, i);
+    }
+    int key = 0;
+    for (auto _ : state) {
+        s21::map<int, int> next(current);
+        next.insert_or_assign(key, -key);
+        benchmark::DoNotOptimize(next.size());
+        key = (key + 7919) % n;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_persistent_map_update(benchmark::State &state) {
+    int n = static_cast<int>(state.range(0));
+    s21::persistent_map<int, int> current;
+    for (int i = 0; i < n; ++i) {
+        current = current.insert(i, i);
+    }
+    int key = 0;
+    for (auto _ : state) {
+        s21::persistent_map<int, int> next = current.insert_or_assign(key, -key);
+        benchmark::DoNotOptimize(next.size());
+        key = (key + 7919) % n;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_map_copy_update)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_persistent_map_update)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "s21_multiset.h"
+#include "s21_priority_queue.h"
+
+/*  event schedules of kEvents timestamps. schedule: push every event,
+ * then pop them all in time order. hold: keep state.range(0) pending
+ * events and replace the earliest one by a later event kEvents times  */
+
+static std::int64_t const kEvents = 1000000;
+
+static std::vector<std::int64_t> make_times(std::size_t n) {
+    std::mt19937_64 gen(1);
+    std::uniform_int_distribution<std::int64_t> dist(0, 1 << 30);
+    std::vector<std::int64_t> times(n);
+    for (auto &t : times) {
+        t = dist(gen);
+    }
+    return times;
+}
+
+struct multiset_scheduler {
+    s21::multiset<std::int64_t> events;
+
+    void push(std::int64_t t) { events.insert(t); }
+    std::int64_t pop() {
+        auto first = events.begin();
+        std::int64_t t = *first;
+        events.erase(first);
+        return t;
+    }
+};
+
+template <std::size_t Arity>
+struct heap_scheduler {
+    s21::priority_queue<std::int64_t, s21::vector<std::int64_t>, std::greater<std::int64_t>, Arity> events;
+
+    void push(std::int64_t t) { events.push(t); }
+    std::int64_t pop() {
+        std::int64_t t = events.top();
+        events.pop();
+        return t;
+    }
+};
+
+template <class Scheduler>
+static void BM_schedule(benchmark::State &state) {
+    auto times = make_times(static_cast<std::size_t>(kEvents));
+    for (auto _ : state) {
+        Scheduler s;
+        for (auto t : times) {
+            s.push(t);
+        }
+        std::int64_t last = 0;
+        for (std::int64_t i = 0; i < kEvents; ++i) {
+            last = s.pop();
+        }
+        benchmark::DoNotOptimize(last);
+    }
+    state.SetItemsProcessed(state.iterations() * kEvents);
+}
+
+template <class Scheduler>
+static void BM_hold(benchmark::State &state) {
+    auto pending = static_cast<std::size_t>(state.range(0));
+    auto times = make_times(pending + static_cast<std::size_t>(kEvents));
+    for (auto _ : state) {
+        state.PauseTiming();
+        Scheduler s;
+        for (std::size_t i = 0; i < pending; ++i) {
+            s.push(times[i]);
+        }
+        state.ResumeTiming();
+        for (std::size_t i = pending; i < times.size(); ++i) {
+            s.push(s.pop() + times[i] % 4096);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kEvents);
+}
+
+BENCHMARK_TEMPLATE(BM_schedule, multiset_scheduler)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_schedule, heap_scheduler<2>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_schedule, heap_scheduler<4>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_hold, multiset_scheduler)->Arg(1000)->Arg(100000)->ArgName("pending")->Unit(
+    benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_hold, heap_scheduler<2>)->Arg(1000)->Arg(100000)->ArgName("pending")->Unit(
+    benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_hold, heap_scheduler<4>)->Arg(1000)->Arg(100000)->ArgName("pending")->Unit(
+    benchmark::kMillisecond);
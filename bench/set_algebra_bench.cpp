@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <thread>
+
+#include "s21_parallel_set_algebra.h"
+#include "s21_set.h"
+
+static s21::set<int> make_set(std::size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(4 * n));
+    s21::set<int> s;
+    while (s.size() < n) {
+        s.insert(dist(gen));
+    }
+    return s;
+}
+
+template <s21::set<int> (*Op)(s21::set<int> &&, s21::set<int> &&, std::size_t)>
+static void BM_set_algebra(benchmark::State &state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto threads = static_cast<std::size_t>(state.range(1));
+    auto lhs = make_set(n, 1);
+    auto rhs = make_set(n, 2);
+    for (auto _ : state) {
+        state.PauseTiming();
+        s21::set<int> a(lhs);
+        s21::set<int> b(rhs);
+        state.ResumeTiming();
+        auto result = Op(std::move(a), std::move(b), threads);
+        benchmark::DoNotOptimize(result.empty());
+        state.PauseTiming();
+        result.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * n));
+}
+
+static void thread_sweep(benchmark::internal::Benchmark *b) {
+    auto cores = static_cast<int64_t>(std::thread::hardware_concurrency());
+    for (int64_t n : {100000, 1000000}) {
+        for (int64_t threads = 1; threads <= cores; threads *= 2) {
+            b->Args({n, threads});
+        }
+        if ((cores & (cores - 1)) != 0) {
+            b->Args({n, cores});
+        }
+    }
+    b->ArgNames({"n", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_TEMPLATE(BM_set_algebra, s21::set_union<int>)->Apply(thread_sweep);
+BENCHMARK_TEMPLATE(BM_set_algebra, s21::set_intersection<int>)->Apply(thread_sweep);
+BENCHMARK_TEMPLATE(BM_set_algebra, s21::set_difference<int>)->Apply(thread_sweep);
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_sharded_map.h"
+
+/*  write-heavy mix on 100000 keys: 50% insert_or_assign, 25% erase and
+ * 25% find. Shards = 1 is a single s21::map behind one mutex  */
+
+static int const kKeys = 100000;
+
+template <std::size_t Shards>
+static s21::sharded_map<int, int, Shards> &shared_map() {
+    static s21::sharded_map<int, int, Shards> m;
+    return m;
+}
+
+template <std::size_t Shards>
+static void BM_sharded_map_write_heavy(benchmark::State &state) {
+    auto &m = shared_map<Shards>();
+    unsigned seed = static_cast<unsigned>(state.thread_index()) + 1;
+    for (auto _ : state) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = seed >> 8;
+        int key = static_cast<int>(r % kKeys);
+        switch (r % 4) {
+            case 0:
+                m.erase(key);
+                break;
+            case 1:
+                benchmark::DoNotOptimize(m.find(key));
+                break;
+            default:
+                m.insert_or_assign(key, key);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_sharded_map_write_heavy, 1)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_sharded_map_write_heavy, 4)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_sharded_map_write_heavy, 16)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_sharded_map_write_heavy, 64)->ThreadRange(1, 64)->UseRealTime();
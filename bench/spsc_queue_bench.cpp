@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "s21_queue.h"
+#include "s21_spsc_queue.h"
+
+/*  producer and consumer are pinned to the first two cores when the machine
+ * has them, every wait loop yields so that the benchmark still finishes on
+ * a single core  */
+
+static void pin_to_core(unsigned core) {
+#ifdef __linux__
+    if (core < std::thread::hardware_concurrency()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#else
+    (void)core;
+#endif
+}
+
+static std::int64_t const kMessages = 1 << 20;
+
+static void BM_spsc_queue_throughput(benchmark::State &state) {
+    auto batch = static_cast<std::size_t>(state.range(0));
+    pin_to_core(0);
+    s21::spsc_queue<std::int64_t> q(4096);
+    std::vector<std::int64_t> buffer(batch);
+    for (auto _ : state) {
+        std::thread producer([&q, batch]() {
+            pin_to_core(1);
+            std::vector<std::int64_t> out(batch);
+            for (std::int64_t i = 0; i < kMessages;) {
+                for (std::size_t j = 0; j < batch; ++j) {
+                    out[j] = i + static_cast<std::int64_t>(j);
+                }
+                std::size_t count = std::min(batch, static_cast<std::size_t>(kMessages - i));
+                std::size_t pushed = (batch == 1) ? q.try_push(out[0]) : q.try_push_n(out.begin(), count);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                i += static_cast<std::int64_t>(pushed);
+            }
+        });
+        for (std::int64_t received = 0; received < kMessages;) {
+            std::size_t popped = (batch == 1) ? q.try_pop(buffer[0]) : q.try_pop_n(buffer.begin(), batch);
+            if (popped == 0) {
+                std::this_thread::yield();
+            }
+            received += static_cast<std::int64_t>(popped);
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kMessages);
+}
+
+static void BM_mutex_queue_throughput(benchmark::State &state) {
+    pin_to_core(0);
+    s21::queue<std::int64_t> q;
+    std::mutex lock;
+    for (auto _ : state) {
+        std::thread producer([&q, &lock]() {
+            pin_to_core(1);
+            for (std::int64_t i = 0; i < kMessages; ++i) {
+                std::lock_guard<std::mutex> guard(lock);
+                q.push(i);
+            }
+        });
+        for (std::int64_t received = 0; received < kMessages;) {
+            std::unique_lock<std::mutex> guard(lock);
+            if (q.empty()) {
+                guard.unlock();
+                std::this_thread::yield();
+            } else {
+                q.pop();
+                ++received;
+            }
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kMessages);
+}
+
+/*  one-way latency as half of a ping-pong round trip over two queues,
+ * reported as percentiles of a 10ns-bucket histogram  */
+static void BM_spsc_queue_latency(benchmark::State &state) {
+    using clock = std::chrono::steady_clock;
+    std::int64_t const bucket_ns = 10;
+    std::vector<std::int64_t> histogram(100001, 0);
+    s21::spsc_queue<std::int64_t> ping(64);
+    s21::spsc_queue<std::int64_t> pong(64);
+    pin_to_core(0);
+    std::thread echo([&ping, &pong]() {
+        pin_to_core(1);
+        std::int64_t value = 0;
+        while (value >= 0) {
+            while (!ping.try_pop(value)) {
+                std::this_thread::yield();
+            }
+            while (!pong.try_push(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::int64_t samples = 0;
+    for (auto _ : state) {
+        auto start = clock::now();
+        std::int64_t value = 0;
+        while (!ping.try_push(samples)) {
+        }
+        while (!pong.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        std::int64_t one_way =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count() / 2;
+        histogram[static_cast<std::size_t>(std::min<std::int64_t>(one_way / bucket_ns, 100000))]++;
+        ++samples;
+    }
+    while (!ping.try_push(-1)) {
+    }
+    echo.join();
+    auto percentile = [&histogram, samples, bucket_ns](double p) {
+        std::int64_t rank = static_cast<std::int64_t>(p * static_cast<double>(samples));
+        std::int64_t seen = 0;
+        std::size_t bucket = 0;
+        while (bucket + 1 < histogram.size() && seen + histogram[bucket] <= rank) {
+            seen += histogram[bucket++];
+        }
+        return static_cast<double>(static_cast<std::int64_t>(bucket) * bucket_ns);
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+}
+
+BENCHMARK(BM_spsc_queue_throughput)->Arg(1)->Arg(16)->Arg(256)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_mutex_queue_throughput)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_spsc_queue_latency);
@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "s21_containers.h"
 #include "s21_containersplus.h"
@@ -266,6 +272,129 @@ TEST(s21_containers, s21_list_sort_1) {
     }
 }
 
+TEST(s21_containers, s21_list_splice_2) {
+    s21::list<int> l1({1, 2, 3});
+    s21::list<int> l2;
+    l1.splice(l1.begin(), l2);
+    EXPECT_EQ(l1.size(), 3);
+    EXPECT_EQ(*--l1.end(), 3);
+
+    l2.splice(l2.end(), l1);
+    EXPECT_TRUE(l1.empty());
+    EXPECT_EQ(l2.size(), 3);
+    EXPECT_EQ(l2.back(), 3);
+    EXPECT_EQ(*--(--l2.end()), 2);
+}
+
+TEST(s21_containers, s21_list_splice_range) {
+    s21::list<int> l1({1, 2, 3, 4, 5});
+    s21::list<int> l2({10, 20});
+
+    l2.splice(++l2.begin(), l1, ++l1.begin());
+    l2.splice(l2.end(), l1, ++l1.begin(), l1.end());
+    l1.splice(l1.begin(), l2, l2.begin(), ++(++l2.begin()), 2);
+
+    int res1[] = {10, 2, 1};
+    int res2[] = {20, 3, 4, 5};
+    EXPECT_EQ(l1.size(), 3);
+    EXPECT_EQ(l2.size(), 4);
+    std::size_t i = 0;
+    for (auto it = l1.begin(); it != l1.end(); ++it) {
+        EXPECT_EQ(*it, res1[i++]);
+    }
+    i = 0;
+    for (auto it = l2.begin(); it != l2.end(); ++it) {
+        EXPECT_EQ(*it, res2[i++]);
+    }
+    i = 4;
+    for (auto it = l2.end(); it != l2.begin();) {
+        EXPECT_EQ(*--it, res2[--i]);
+    }
+
+    l1.splice(l1.begin(), l1, --l1.end());
+    EXPECT_EQ(l1.front(), 1);
+    l1.splice(l1.end(), l1, l1.begin(), ++(++l1.begin()));
+    int res3[] = {2, 1, 10};
+    EXPECT_EQ(l1.size(), 3);
+    i = 0;
+    for (auto it = l1.begin(); it != l1.end(); ++it) {
+        EXPECT_EQ(*it, res3[i++]);
+    }
+}
+
+TEST(s21_containers, s21_list_merge_comp) {
+    s21::list<int> l1({9, 7, 3});
+    s21::list<int> l2({8, 3, 2, 1, 0});
+
+    l1.merge(l2, std::greater<int>());
+
+    int res[] = {9, 8, 7, 3, 3, 2, 1, 0};
+    EXPECT_EQ(l1.size(), 8);
+    EXPECT_TRUE(l2.empty());
+    std::size_t i = 0;
+    for (auto it = l1.begin(); it != l1.end(); ++it) {
+        EXPECT_EQ(*it, res[i++]);
+    }
+    EXPECT_EQ(l1.back(), 0);
+    EXPECT_EQ(*--(--l1.end()), 1);
+}
+
+TEST(s21_containers, s21_list_sort_comp) {
+    s21::list<std::pair<int, int>> l;
+    for (int i = 0; i < 100000; ++i) {
+        l.push_back(std::make_pair((i * 7919) % 100, i));
+    }
+    l.sort([](std::pair<int, int> const &a, std::pair<int, int> const &b) { return a.first < b.first; });
+    EXPECT_EQ(l.size(), 100000);
+    auto prev = l.front();
+    for (auto it = ++l.begin(); it != l.end(); ++it) {
+        EXPECT_TRUE(prev.first < (*it).first || (prev.first == (*it).first && prev.second < (*it).second));
+        prev = *it;
+    }
+    EXPECT_EQ(l.back().first, 99);
+    EXPECT_EQ((*--(--l.end())).first, 99);
+}
+
+TEST(s21_containers, s21_list_unique_pred) {
+    s21::list<int> l({1, 3, 5, 2, 4, 7, 8, 10});
+    l.unique([](int a, int b) { return a % 2 == b % 2; });
+    int res[] = {1, 2, 7, 8};
+    EXPECT_EQ(l.size(), 4);
+    std::size_t i = 0;
+    for (auto it = l.begin(); it != l.end(); ++it) {
+        EXPECT_EQ(*it, res[i++]);
+    }
+}
+
+TEST(s21_containers, s21_list_node_cache) {
+    s21::list<int> l;
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(i);
+    }
+    EXPECT_EQ(l.cached_nodes(), 0);
+    while (!l.empty()) {
+        l.pop_front();
+    }
+    EXPECT_EQ(l.cached_nodes(), l.cache_limit());
+    EXPECT_GE(l.memory_usage().slack, l.cached_nodes() * (sizeof(int) + 2 * sizeof(void *)));
+    s21::container_stats before = l.stats();
+    for (int i = 0; i < 10; ++i) {
+        l.push_back(i);
+    }
+    EXPECT_EQ((l.stats() - before).allocations, 0);
+    EXPECT_EQ(l.cached_nodes(), l.cache_limit() - 10);
+    EXPECT_EQ(l.front(), 0);
+    EXPECT_EQ(l.back(), 9);
+    l.set_cache_limit(5);
+    EXPECT_EQ(l.cached_nodes(), 5);
+    l.shrink_to_fit();
+    EXPECT_EQ(l.cached_nodes(), 0);
+    EXPECT_EQ(l.cache_limit(), 5);
+    l.clear();
+    EXPECT_EQ(l.cached_nodes(), 5);
+    EXPECT_EQ(l.memory_usage().payload, 0);
+}
+
 // s21_vector
 TEST(s21_containers, s21_vector_constructor_1) {
     s21::vector<int> v;
@@ -975,6 +1104,70 @@ TEST(s21_containers, s21_map_emplase) {
     EXPECT_EQ(s.size(), 7);
 }
 
+TEST(s21_containers, s21_map_erase_key) {
+    s21::map<int, std::string> m{{42, "foo"}, {3, "bar"}, {7, "baz"}};
+    EXPECT_EQ(m.erase(3), 1);
+    EXPECT_EQ(m.erase(4), 0);
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_FALSE(m.contains(3));
+}
+
+TEST(s21_containers, s21_map_erase_if) {
+    s21::map<int, int> m;
+    for (int i = 0; i < 100; ++i) {
+        m.insert(i, i * i);
+    }
+    EXPECT_EQ(erase_if(m, [](auto const &item) { return item.second > 100; }), 89);
+    EXPECT_EQ(m.size(), 11);
+    EXPECT_EQ(m[10], 100);
+    m.erase(m.begin(), m.end());
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(s21_containers, s21_map_split_join) {
+    s21::map<int, std::string> m{{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}};
+    auto right = m.split(3);
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_EQ(right.size(), 2);
+    EXPECT_FALSE(m.contains(3));
+    EXPECT_EQ(right[3], "c");
+    right.join(m);
+    EXPECT_EQ(right.size(), 4);
+    EXPECT_EQ(right[1], "a");
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(s21_containers, s21_map_find_many) {
+    s21::map<int, char> m({{1, 'a'}, {5, 'e'}, {9, 'i'}});
+    int keys[] = {9, 2, 1, 5, 7};
+    s21::map<int, char>::iterator found[5] = {m.end(), m.end(), m.end(), m.end(), m.end()};
+    m.find_many(keys, 5, found);
+    EXPECT_EQ((*found[0]).second, 'i');
+    EXPECT_TRUE(found[1] == m.end());
+    EXPECT_EQ((*found[2]).second, 'a');
+    EXPECT_EQ((*found[3]).second, 'e');
+    EXPECT_TRUE(found[4] == m.end());
+    bool present[5] = {};
+    m.contains_many(keys, 5, present);
+    EXPECT_TRUE(present[0] && !present[1] && present[2] && present[3] && !present[4]);
+    s21::map<int, std::string> words;
+    for (int i = 0; i < 1000; i += 2) {
+        words.insert(i, std::to_string(i));
+    }
+    int many[1000];
+    for (int i = 0; i < 1000; ++i) {
+        many[i] = 999 - i;
+    }
+    bool hits[1000] = {};
+    words.contains_many(many, 1000, hits);
+    int found_count = 0;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(hits[i], many[i] % 2 == 0);
+        found_count += hits[i];
+    }
+    EXPECT_EQ(found_count, 500);
+}
+
 // s21_set
 TEST(s21_containers, s21_set_constructor_1) {
     s21::set<int> s;
@@ -1102,6 +1295,298 @@ TEST(s21_containers, s21_set_emplase) {
     EXPECT_EQ(s.size(), 7);
 }
 
+TEST(s21_containers, s21_set_erase_range) {
+    s21::set<int> s;
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+    s.erase(s.find(10), s.find(20));
+    EXPECT_EQ(s.size(), 90);
+    EXPECT_FALSE(s.contains(10));
+    EXPECT_FALSE(s.contains(19));
+    EXPECT_TRUE(s.contains(20));
+
+    s.erase(s.begin(), s.find(90));
+    EXPECT_EQ(s.size(), 10);
+    EXPECT_EQ(*s.begin(), 90);
+    for (int i = 0; i < 90; ++i) {
+        s.insert(i);
+    }
+    EXPECT_EQ(s.size(), 100);
+    int expected = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected++);
+    }
+}
+
+TEST(s21_containers, s21_set_erase_key) {
+    s21::set<int> s({1, 3, 4, 5, 6});
+    EXPECT_EQ(s.erase(4), 1);
+    EXPECT_EQ(s.erase(7), 0);
+    EXPECT_EQ(s.size(), 4);
+    EXPECT_FALSE(s.contains(4));
+}
+
+TEST(s21_containers, s21_set_erase_if) {
+    s21::set<int> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+    EXPECT_EQ(erase_if(s, [](int key) { return key % 3 != 0; }), 666);
+    EXPECT_EQ(s.size(), 334);
+    int expected = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected);
+        expected += 3;
+    }
+    s.erase(s.find(300));
+    s.insert(1);
+    EXPECT_EQ(*++s.begin(), 1);
+}
+
+TEST(s21_containers, s21_set_erase_if_throwing_pred) {
+    s21::set<int> s;
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+    auto pred = [](int key) {
+        if (key == 50) {
+            throw std::runtime_error("pred");
+        }
+        return key % 2 == 0;
+    };
+    EXPECT_THROW(erase_if(s, pred), std::runtime_error);
+    EXPECT_EQ(s.size(), 100);
+    int expected = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected++);
+    }
+    EXPECT_EQ(expected, 100);
+}
+
+TEST(s21_containers, s21_set_split) {
+    s21::set<int> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+    auto right = s.split(400);
+    EXPECT_EQ(s.size(), 400);
+    EXPECT_EQ(right.size(), 600);
+    EXPECT_EQ(*--s.end(), 399);
+    EXPECT_EQ(*right.begin(), 400);
+    EXPECT_EQ(*--right.end(), 999);
+    s.insert(400);
+    EXPECT_EQ(s.size(), 401);
+    right.erase(right.begin());
+    EXPECT_EQ(right.size(), 599);
+    for (int key = -1; key <= 21; ++key) {
+        s21::set<int> whole;
+        for (int i = 0; i < 20; ++i) {
+            whole.insert(i);
+        }
+        auto upper = whole.split(key);
+        std::size_t lower_size = static_cast<std::size_t>(std::min(std::max(key, 0), 20));
+        EXPECT_EQ(whole.size(), lower_size);
+        EXPECT_EQ(upper.size(), 20 - lower_size);
+    }
+}
+
+TEST(s21_containers, s21_set_join) {
+    s21::set<int> s1({1, 2, 3});
+    s21::set<int> s2({10, 11});
+    s21::set<int> s3({-5, 0});
+    s1.join(s2);
+    s1.join(s3);
+    EXPECT_EQ(s1.size(), 7);
+    EXPECT_TRUE(s2.empty());
+    EXPECT_TRUE(s3.empty());
+    int expected[] = {-5, 0, 1, 2, 3, 10, 11};
+    int i = 0;
+    for (auto const key : s1) {
+        EXPECT_EQ(key, expected[i++]);
+    }
+    s21::set<int> overlap({2, 4});
+    EXPECT_THROW(s1.join(overlap), std::invalid_argument);
+}
+
+TEST(s21_containers, s21_set_union) {
+    s21::set<int> s1({1, 3, 5, 7});
+    s21::set<int> s2({2, 3, 4, 7, 9});
+    auto s = s21::set_union(s1, s2);
+    EXPECT_EQ(s.size(), 7);
+    EXPECT_EQ(s1.size(), 4);
+    EXPECT_EQ(s2.size(), 5);
+    int expected[] = {1, 2, 3, 4, 5, 7, 9};
+    int i = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected[i++]);
+    }
+    auto forked = s21::set_union(s21::set<int>(s1), s21::set<int>(s2), 0);
+    EXPECT_EQ(forked.size(), 7);
+    EXPECT_EQ(*forked.begin(), 1);
+    EXPECT_EQ(*--forked.end(), 9);
+}
+
+TEST(s21_containers, s21_set_intersection) {
+    s21::set<int> s1;
+    s21::set<int> s2;
+    for (int i = 0; i < 100000; ++i) {
+        s1.insert(i * 2);
+        s2.insert(i * 3);
+    }
+    auto s = s21::set_intersection(std::move(s1), std::move(s2), 4);
+    EXPECT_EQ(s.size(), 33334);
+    int expected = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected);
+        expected += 6;
+    }
+}
+
+TEST(s21_containers, s21_set_difference) {
+    s21::set<int> s1({1, 2, 3, 4, 5, 6});
+    s21::set<int> s2({2, 4, 6, 8});
+    auto s = s21::set_difference(s1, s2);
+    EXPECT_EQ(s.size(), 3);
+    int expected[] = {1, 3, 5};
+    int i = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected[i++]);
+    }
+    EXPECT_TRUE(s21::set_difference(s2, s2).empty());
+}
+
+TEST(s21_containers, s21_set_algebra_const) {
+    s21::set<int> small({-4, 0, 10, 15, 5001});
+    s21::set<int> large;
+    for (int i = 0; i < 1000; ++i) {
+        large.insert(i * 5);
+    }
+    auto both = s21::set_intersection(small, large);
+    auto small_only = s21::set_difference(small, large);
+    auto large_only = s21::set_difference(large, small);
+    auto any = s21::set_union(large, small);
+    EXPECT_EQ(small.size(), 5);
+    EXPECT_EQ(large.size(), 1000);
+    int expected_both[] = {0, 10, 15};
+    int i = 0;
+    for (auto const key : both) {
+        EXPECT_EQ(key, expected_both[i++]);
+    }
+    EXPECT_EQ(i, 3);
+    int expected_small[] = {-4, 5001};
+    i = 0;
+    for (auto const key : small_only) {
+        EXPECT_EQ(key, expected_small[i++]);
+    }
+    EXPECT_EQ(i, 2);
+    EXPECT_EQ(large_only.size(), 997);
+    EXPECT_FALSE(large_only.contains(10));
+    EXPECT_TRUE(large_only.contains(5));
+    EXPECT_EQ(any.size(), 1002);
+    EXPECT_EQ(*any.begin(), -4);
+    EXPECT_EQ(*--any.end(), 5001);
+    auto moved = s21::set_union(std::move(any), std::move(large_only));
+    EXPECT_EQ(moved.size(), 1002);
+    EXPECT_TRUE(large_only.empty());
+}
+
+TEST(s21_containers, s21_set_lower_bound) {
+    s21::set<int> s({10, 20, 30});
+    EXPECT_EQ(*s.lower_bound(15), 20);
+    EXPECT_EQ(*s.lower_bound(20), 20);
+    EXPECT_EQ(*s.upper_bound(20), 30);
+    EXPECT_TRUE(s.lower_bound(31) == s.end());
+}
+
+TEST(s21_containers, s21_set_iterate_after_updates) {
+    s21::set<int> s;
+    bool present[1000] = {};
+    for (int i = 0; i < 3000; ++i) {
+        int key = (i * 7919) % 1000;
+        if (i % 3 == 2) {
+            s.erase(key);
+            present[key] = false;
+        } else {
+            s.insert(key);
+            present[key] = true;
+        }
+    }
+    int expected = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) {
+        while (present[expected] == false) {
+            ++expected;
+        }
+        EXPECT_EQ(*it, expected++);
+    }
+    auto it = s.end();
+    for (int key = 999; key >= 0; --key) {
+        if (present[key]) {
+            EXPECT_EQ(*--it, key);
+        }
+    }
+    EXPECT_TRUE(it == s.begin());
+    EXPECT_TRUE(++s.end() == s.end());
+}
+
+TEST(s21_containers, s21_set_iterate_after_split_join) {
+    s21::set<int> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+    s21::set<int> right = s.split(600);
+    right.erase(700);
+    s.insert(-1);
+    EXPECT_EQ(*--s.end(), 599);
+    EXPECT_EQ(*right.begin(), 600);
+    s.join(right);
+    s.erase(s.find(300));
+    int expected = -1;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected);
+        expected += (expected == 299 || expected == 699) ? 2 : 1;
+    }
+    EXPECT_EQ(expected, 1000);
+    EXPECT_EQ(*--s.end(), 999);
+    s.clear();
+    EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(s21_containers, s21_set_contains_many) {
+    s21::set<int> s;
+    for (int i = 0; i < 10000; i += 3) {
+        s.insert(i);
+    }
+    std::vector<int> keys;
+    for (int i = -5; i < 10005; ++i) {
+        keys.push_back((i * 7) % 10010);
+    }
+    bool present[10010] = {};
+    s.contains_many(keys.data(), keys.size(), present);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(present[i], s.contains(keys[i]));
+    }
+    s.contains_many<1>(keys.data(), 40, present);
+    for (std::size_t i = 0; i < 40; ++i) {
+        EXPECT_EQ(present[i], s.contains(keys[i]));
+    }
+    s21::set<int> empty;
+    empty.contains_many(keys.data(), 20, present);
+    EXPECT_FALSE(present[0] || present[19]);
+}
+
+TEST(s21_containers, s21_set_find_many) {
+    s21::set<int> s({10, 20, 30, 40});
+    int keys[] = {40, 15, 10, 30, 99};
+    std::vector<s21::set<int>::iterator> found(5, s.end());
+    s.find_many<4>(keys, 5, found.data());
+    EXPECT_EQ(*found[0], 40);
+    EXPECT_TRUE(found[1] == s.end());
+    EXPECT_EQ(*found[2], 10);
+    EXPECT_EQ(*++found[3], 40);
+    EXPECT_TRUE(found[4] == s.end());
+}
+
 // s21_multiset
 TEST(s21_containers, s21_multiset_constructor_1) {
     s21::multiset<int> m;
@@ -1238,6 +1723,1252 @@ TEST(s21_containers, s21_multiset_emplase) {
     EXPECT_EQ(s.size(), 8);
 }
 
+TEST(s21_containers, s21_multiset_erase_key) {
+    s21::multiset<int> m({1, 3, 4, 5, 5, 5, 5, 6});
+    EXPECT_EQ(m.erase(5), 4);
+    EXPECT_EQ(m.size(), 4);
+    EXPECT_FALSE(m.contains(5));
+    EXPECT_EQ(*--m.end(), 6);
+    EXPECT_EQ(m.lower_bound(7), m.end());
+    EXPECT_EQ(m.upper_bound(6), m.end());
+}
+
+TEST(s21_containers, s21_multiset_erase_if) {
+    s21::multiset<int> m({1, 1, 2, 2, 3, 3});
+    EXPECT_EQ(s21::erase_if(m, [](int key) { return key == 2; }), 2);
+    EXPECT_EQ(m.size(), 4);
+    EXPECT_EQ(m.count(1), 2);
+    EXPECT_EQ(m.count(3), 2);
+}
+
+TEST(s21_containers, s21_multiset_contains_many) {
+    s21::multiset<int> s({1, 1, 2, 4, 4, 4});
+    int keys[] = {4, 3, 1, 0, 2};
+    bool present[5] = {};
+    s.contains_many(keys, 5, present);
+    EXPECT_TRUE(present[0] && !present[1] && present[2] && !present[3] && present[4]);
+}
+
+// s21_frozen_set
+TEST(s21_containers, s21_frozen_set_constructor_1) {
+    s21::frozen_set<int> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.begin(), s.end());
+    EXPECT_FALSE(s.contains(0));
+}
+
+TEST(s21_containers, s21_frozen_set_constructor_2) {
+    s21::frozen_set<int> s({5, 3, 9, 3, 1, 5});
+    EXPECT_EQ(s.size(), 4);
+    int expected[] = {1, 3, 5, 9};
+    int i = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected[i++]);
+    }
+    EXPECT_EQ(i, 4);
+}
+
+TEST(s21_containers, s21_frozen_set_constructor_3) {
+    s21::frozen_set<int> origin({1, 2, 3});
+    s21::frozen_set<int> copy(origin);
+    s21::frozen_set<int> moved(std::move(origin));
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_TRUE(origin.empty());
+    EXPECT_TRUE(copy.contains(2));
+    EXPECT_TRUE(moved.contains(3));
+}
+
+TEST(s21_containers, s21_frozen_set_constructor_4) {
+    int items[] = {7, 2, 9, 2, 4, 7, 1};
+    s21::frozen_set<int> s(items, items + 7);
+    EXPECT_EQ(s.size(), 5);
+    int expected[] = {1, 2, 4, 7, 9};
+    int i = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) {
+        EXPECT_EQ(*it, expected[i++]);
+    }
+    for (int key : items) {
+        EXPECT_TRUE(s.contains(key));
+    }
+    EXPECT_FALSE(s.contains(3));
+}
+
+TEST(s21_containers, s21_frozen_set_freeze) {
+    s21::set<int> origin;
+    for (int i = 0; i < 1000; ++i) {
+        origin.insert(i * 2);
+    }
+    auto s = origin.freeze();
+    EXPECT_EQ(s.size(), origin.size());
+    for (int i = -1; i < 2001; ++i) {
+        EXPECT_EQ(s.contains(i), i >= 0 && i < 2000 && i % 2 == 0);
+    }
+    int prev = -1;
+    for (auto it = s.begin(); it != s.end(); ++it) {
+        EXPECT_EQ(*it, prev + 1);
+        prev = *it + 1;
+    }
+    EXPECT_EQ(*--s.end(), 1998);
+}
+
+TEST(s21_containers, s21_frozen_set_find) {
+    s21::frozen_set<int> s({1, 3, 4, 5, 6});
+    EXPECT_EQ(*s.find(5), 5);
+    EXPECT_EQ(*s.find(1), 1);
+    EXPECT_EQ(s.find(2), s.end());
+    EXPECT_EQ(s.count(4), 1);
+    EXPECT_EQ(s.count(7), 0);
+}
+
+TEST(s21_containers, s21_frozen_set_lower_bound) {
+    s21::frozen_set<int> s({10, 20, 30, 40, 50, 60, 70});
+    EXPECT_EQ(*s.lower_bound(0), 10);
+    EXPECT_EQ(*s.lower_bound(25), 30);
+    EXPECT_EQ(*s.lower_bound(70), 70);
+    EXPECT_EQ(s.lower_bound(71), s.end());
+}
+
+// s21_counted_multiset
+TEST(s21_containers, s21_counted_multiset_constructor_1) {
+    s21::counted_multiset<int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(s21_containers, s21_counted_multiset_constructor_2) {
+    s21::counted_multiset<int> m({1, 3, 3, 3, 6});
+    s21::counted_multiset<int> copy(m);
+    s21::counted_multiset<int> moved(std::move(m));
+    EXPECT_EQ(copy.size(), 5);
+    EXPECT_EQ(copy.distinct_size(), 3);
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(m.size(), 0);
+}
+
+TEST(s21_containers, s21_counted_multiset_insert) {
+    s21::counted_multiset<int> m;
+    for (int i = 0; i < 10000; ++i) {
+        m.insert(i % 7);
+    }
+    EXPECT_EQ(m.size(), 10000);
+    EXPECT_EQ(m.distinct_size(), 7);
+    EXPECT_EQ(m.count(0), 1429);
+    EXPECT_EQ(m.count(6), 1428);
+    EXPECT_EQ(m.count(7), 0);
+}
+
+TEST(s21_containers, s21_counted_multiset_iterate) {
+    s21::counted_multiset<int> m({5, 1, 3, 3, 1, 3});
+    int expected[] = {1, 1, 3, 3, 3, 5};
+    int i = 0;
+    for (auto const key : m) {
+        EXPECT_EQ(key, expected[i++]);
+    }
+    EXPECT_EQ(i, 6);
+    auto it = m.end();
+    for (i = 5; i >= 0; --i) {
+        EXPECT_EQ(*--it, expected[i]);
+    }
+    EXPECT_EQ(it, m.begin());
+}
+
+TEST(s21_containers, s21_counted_multiset_erase) {
+    s21::counted_multiset<int> m({1, 3, 3, 6});
+    m.erase(m.find(3));
+    EXPECT_EQ(m.count(3), 1);
+    EXPECT_EQ(m.size(), 3);
+    m.erase(m.find(3));
+    EXPECT_FALSE(m.contains(3));
+    EXPECT_EQ(m.distinct_size(), 2);
+    EXPECT_EQ(m.size(), 2);
+}
+
+TEST(s21_containers, s21_counted_multiset_equal_range) {
+    s21::counted_multiset<int> m({1, 3, 4, 5, 5, 5, 5, 6});
+    auto range = m.equal_range(5);
+    int n = 0;
+    for (auto it = range.first; it != range.second; it++, n++) {
+        EXPECT_EQ(*it, 5);
+    }
+    EXPECT_EQ(n, 4);
+    EXPECT_EQ(*range.second, 6);
+}
+
+TEST(s21_containers, s21_counted_multiset_swap_merge) {
+    s21::counted_multiset<int> m1({1, 2, 2});
+    s21::counted_multiset<int> m2({2, 7});
+    m1.swap(m2);
+    EXPECT_EQ(m1.size(), 2);
+    EXPECT_EQ(m2.size(), 3);
+    m1.merge(m2);
+    EXPECT_EQ(m1.size(), 5);
+    EXPECT_EQ(m1.count(2), 3);
+    EXPECT_EQ(m1.distinct_size(), 3);
+}
+
+// s21_persistent_map
+TEST(s21_containers, s21_persistent_map_constructor) {
+    s21::persistent_map<int, char> m1;
+    EXPECT_TRUE(m1.empty());
+    s21::persistent_map<int, char> m2({{2, 'b'}, {1, 'a'}, {3, 'c'}, {1, 'z'}});
+    EXPECT_EQ(m2.size(), 3);
+    EXPECT_EQ(m2.at(1), 'a');
+    s21::persistent_map<int, char> m3(m2);
+    EXPECT_EQ(m3.size(), 3);
+    EXPECT_EQ(m3[3], 'c');
+    EXPECT_THROW(m3.at(4), std::out_of_range);
+}
+
+TEST(s21_containers, s21_persistent_map_insert) {
+    s21::persistent_map<int, int> v0;
+    auto v1 = v0.insert(1, 10);
+    auto v2 = v1.insert(std::make_pair(2, 20));
+    auto v3 = v2.insert(1, 30);
+    EXPECT_TRUE(v0.empty());
+    EXPECT_EQ(v1.size(), 1);
+    EXPECT_FALSE(v1.contains(2));
+    EXPECT_EQ(v2.size(), 2);
+    EXPECT_EQ(v3.at(1), 10);
+    auto v4 = v3.insert_or_assign(1, 30);
+    EXPECT_EQ(v3.at(1), 10);
+    EXPECT_EQ(v4.at(1), 30);
+    EXPECT_EQ(v4.size(), 2);
+}
+
+TEST(s21_containers, s21_persistent_map_erase) {
+    s21::persistent_map<int, int> v0;
+    for (int i = 0; i < 1000; ++i) {
+        v0 = v0.insert(i, i * i);
+    }
+    auto v1 = v0;
+    for (int i = 0; i < 1000; i += 2) {
+        v1 = v1.erase(i);
+    }
+    v1 = v1.erase(5000);
+    EXPECT_EQ(v0.size(), 1000);
+    EXPECT_EQ(v1.size(), 500);
+    EXPECT_EQ(v0.count(10), 1);
+    EXPECT_EQ(v1.count(10), 0);
+    int expected = 1;
+    for (auto it = v1.begin(); it != v1.end(); ++it) {
+        EXPECT_EQ(it->first, expected);
+        EXPECT_EQ(it->second, expected * expected);
+        expected += 2;
+    }
+}
+
+TEST(s21_containers, s21_persistent_map_iterate) {
+    s21::persistent_map<int, char> m({{1, 'a'}, {3, 'c'}, {5, 'e'}, {7, 'g'}});
+    auto it = m.end();
+    --it;
+    EXPECT_EQ((*it).second, 'g');
+    --it;
+    EXPECT_EQ((*it).second, 'e');
+    ++it;
+    ++it;
+    EXPECT_TRUE(it == m.end());
+    EXPECT_EQ(m.lower_bound(4)->first, 5);
+    EXPECT_EQ(m.upper_bound(5)->first, 7);
+    EXPECT_TRUE(m.lower_bound(8) == m.end());
+    EXPECT_TRUE(m.find(2) == m.end());
+    EXPECT_EQ(m.find(3)->second, 'c');
+}
+
+struct persistent_value {
+    static int copies_left;
+    int value = 0;
+
+    persistent_value() = default;
+    explicit persistent_value(int v) : value(v) {}
+    persistent_value(persistent_value const &other) : value(other.value) {
+        if (copies_left == 0) {
+            throw std::runtime_error("copy");
+        }
+        --copies_left;
+    }
+    persistent_value &operator=(persistent_value const &other) = default;
+};
+
+int persistent_value::copies_left = 0;
+
+TEST(s21_containers, s21_persistent_map_throwing_copy) {
+    persistent_value::copies_left = 1 << 20;
+    s21::persistent_map<int, persistent_value> m;
+    for (int i = 0; i < 64; ++i) {
+        m = m.insert(i * 2, persistent_value(i));
+    }
+    persistent_value extra(-1);
+    int failures = 0;
+    for (int budget = 0; budget < 64; ++budget) {
+        persistent_value::copies_left = budget;
+        try {
+            auto v1 = m.insert(31, extra);
+            auto v2 = v1.insert_or_assign(40, extra);
+            auto v3 = v2.erase(10);
+            EXPECT_EQ(v3.size(), 64);
+        } catch (std::runtime_error const &) {
+            ++failures;
+        }
+        persistent_value::copies_left = 1 << 20;
+        ASSERT_EQ(m.size(), 64);
+        int i = 0;
+        for (auto it = m.begin(); it != m.end(); ++it, ++i) {
+            EXPECT_EQ(it->first, i * 2);
+            EXPECT_EQ(it->second.value, i);
+        }
+        EXPECT_EQ(i, 64);
+    }
+    EXPECT_GT(failures, 0);
+}
+
+// s21_concurrent_map
+TEST(s21_containers, s21_concurrent_map_insert_erase) {
+    s21::concurrent_map<int, char> m({{1, 'a'}, {2, 'b'}});
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_TRUE(m.insert(3, 'c'));
+    EXPECT_FALSE(m.insert(std::make_pair(3, 'z')));
+    EXPECT_EQ(m.at(3), 'c');
+    EXPECT_FALSE(m.insert_or_assign(3, 'z'));
+    EXPECT_EQ(m.at(3), 'z');
+    EXPECT_EQ(m.erase(1), 1);
+    EXPECT_EQ(m.erase(1), 0);
+    EXPECT_FALSE(m.contains(1));
+    EXPECT_THROW(m.at(1), std::out_of_range);
+    m.clear();
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(s21_containers, s21_concurrent_map_snapshot) {
+    s21::concurrent_map<int, int> m;
+    for (int i = 0; i < 100; ++i) {
+        m.insert(i, i);
+    }
+    auto snapshot = m.snapshot();
+    for (int i = 0; i < 100; i += 2) {
+        m.erase(i);
+    }
+    EXPECT_EQ(m.size(), 50);
+    EXPECT_EQ(snapshot.size(), 100);
+    int expected = 0;
+    for (auto const &item : snapshot) {
+        EXPECT_EQ(item.first, expected++);
+    }
+}
+
+TEST(s21_containers, s21_concurrent_map_threads) {
+    s21::concurrent_map<int, int> m;
+    std::atomic<bool> done(false);
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches(0);
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&m, &done, &mismatches, t]() {
+            int key = t;
+            while (!done.load()) {
+                key = (key + 7) % 500;
+                if (m.contains(key) && m.snapshot().at(key) % 500 != key) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 5000; ++i) {
+        if (i % 4 == 0) {
+            m.erase(i % 500);
+        } else {
+            m.insert_or_assign(i % 500, i);
+        }
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(m.size(), 500 - 125);
+}
+
+// s21_sharded_map
+TEST(s21_containers, s21_sharded_map_insert_erase) {
+    s21::sharded_map<int, char, 4> m({{1, 'a'}, {2, 'b'}});
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_EQ(m.shard_count(), 4);
+    EXPECT_TRUE(m.insert(3, 'c'));
+    EXPECT_FALSE(m.insert(std::make_pair(3, 'z')));
+    EXPECT_EQ(m.at(3), 'c');
+    EXPECT_FALSE(m.insert_or_assign(3, 'z'));
+    EXPECT_EQ(*m.find(3), 'z');
+    EXPECT_FALSE(m.find(4).has_value());
+    EXPECT_EQ(m.erase(1), 1);
+    EXPECT_EQ(m.erase(1), 0);
+    EXPECT_FALSE(m.contains(1));
+    EXPECT_THROW(m.at(1), std::out_of_range);
+    m.clear();
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(s21_containers, s21_sharded_map_for_each) {
+    s21::sharded_map<int, int> m;
+    for (int i = 999; i >= 0; --i) {
+        m.insert(i, -i);
+    }
+    long sum = 0;
+    m.for_each([&sum](std::pair<const int, int> const &item) { sum += item.first; });
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+    int expected = 0;
+    m.for_each_ordered([&expected](std::pair<const int, int> const &item) {
+        EXPECT_EQ(item.first, expected);
+        EXPECT_EQ(item.second, -expected);
+        ++expected;
+    });
+    EXPECT_EQ(expected, 1000);
+}
+
+TEST(s21_containers, s21_sharded_map_threads) {
+    s21::sharded_map<int, int, 8> m;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&m, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                m.insert_or_assign(i * 4 + t, t);
+                if (i % 2 == 1) {
+                    m.erase((i - 1) * 4 + t);
+                }
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    EXPECT_EQ(m.size(), 4000);
+    EXPECT_EQ(m.at(7), 3);
+}
+
+// s21_concurrent_set
+TEST(s21_containers, s21_concurrent_set_insert_erase) {
+    s21::concurrent_set<int> s({5, 1, 3});
+    EXPECT_EQ(s.size(), 3);
+    EXPECT_TRUE(s.insert(4).second);
+    EXPECT_FALSE(s.insert(4).second);
+    EXPECT_EQ(*s.insert(2).first, 2);
+    EXPECT_EQ(s.erase(1), 1);
+    EXPECT_EQ(s.erase(1), 0);
+    EXPECT_FALSE(s.contains(1));
+    EXPECT_TRUE(s.find(1) == s.end());
+    EXPECT_EQ(*s.find(3), 3);
+    int expected[] = {2, 3, 4, 5};
+    int i = 0;
+    for (auto const key : s) {
+        EXPECT_EQ(key, expected[i++]);
+    }
+    s.clear();
+    EXPECT_TRUE(s.empty());
+}
+
+TEST(s21_containers, s21_concurrent_set_lower_bound) {
+    s21::concurrent_set<int> s(0.5);
+    EXPECT_DOUBLE_EQ(s.level_probability(), 0.5);
+    for (int i = 0; i < 1000; i += 10) {
+        s.insert(i);
+    }
+    EXPECT_EQ(*s.lower_bound(15), 20);
+    EXPECT_EQ(*s.lower_bound(20), 20);
+    EXPECT_TRUE(s.lower_bound(991) == s.end());
+    EXPECT_EQ(*s.upper_bound(15), 20);
+    EXPECT_EQ(*s.upper_bound(20), 30);
+    EXPECT_TRUE(s.upper_bound(990) == s.end());
+    s.erase(30);
+    EXPECT_EQ(*s.upper_bound(20), 40);
+}
+
+TEST(s21_containers, s21_concurrent_set_threads) {
+    s21::concurrent_set<int> s;
+    std::vector<std::thread> threads;
+    std::atomic<int> unordered(0);
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&s, &unordered, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                s.insert(i * 4 + t);
+                if (i % 2 == 1) {
+                    s.erase((i - 1) * 4 + t);
+                }
+                if (i % 100 == 0) {
+                    int prev = -1;
+                    for (auto it = s.begin(); it != s.end(); ++it) {
+                        unordered += (*it <= prev);
+                        prev = *it;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(unordered.load(), 0);
+    EXPECT_EQ(s.size(), 4000);
+    EXPECT_FALSE(s.contains(0));
+    EXPECT_TRUE(s.contains(7));
+}
+
+// s21_concurrent_skip_map
+TEST(s21_containers, s21_concurrent_skip_map_insert_erase) {
+    s21::concurrent_skip_map<int, char> m({{2, 'b'}, {1, 'a'}});
+    EXPECT_TRUE(m.insert(3, 'c').second);
+    EXPECT_FALSE(m.insert(std::make_pair(3, 'z')).second);
+    EXPECT_EQ(m.at(3), 'c');
+    EXPECT_EQ(m.find(2)->second, 'b');
+    EXPECT_EQ(m.lower_bound(0)->first, 1);
+    EXPECT_EQ(m.upper_bound(1)->first, 2);
+    EXPECT_EQ(m.erase(2), 1);
+    EXPECT_FALSE(m.contains(2));
+    EXPECT_THROW(m.at(2), std::out_of_range);
+    EXPECT_EQ(m.size(), 2);
+}
+
+// s21_spsc_queue
+TEST(s21_containers, s21_spsc_queue_push_pop) {
+    s21::spsc_queue<int> q(5);
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_TRUE(q.empty());
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(8));
+    EXPECT_EQ(q.size(), 8);
+    int value = -1;
+    for (int round = 0; round < 20; ++round) {
+        EXPECT_TRUE(q.try_pop(value));
+        EXPECT_EQ(value, round);
+        EXPECT_TRUE(q.try_emplace(round + 8));
+    }
+    EXPECT_EQ(q.size(), 8);
+}
+
+TEST(s21_containers, s21_spsc_queue_batch) {
+    s21::spsc_queue<std::string> q(4);
+    std::string in[] = {"a", "b", "c", "d", "e"};
+    EXPECT_EQ(q.try_push_n(in, 5), 4);
+    std::string out[3];
+    EXPECT_EQ(q.try_pop_n(out, 3), 3);
+    EXPECT_EQ(out[2], "c");
+    EXPECT_EQ(q.try_push_n(in + 4, 1), 1);
+    EXPECT_EQ(q.try_pop_n(out, 3), 2);
+    EXPECT_EQ(out[0], "d");
+    EXPECT_EQ(out[1], "e");
+    EXPECT_EQ(q.try_pop_n(out, 3), 0);
+    q.try_push(std::string("left in the queue"));
+}
+
+TEST(s21_containers, s21_spsc_queue_threads) {
+    s21::spsc_queue<int> q(64);
+    int const count = 100000;
+    std::thread producer([&q]() {
+        int batch[16];
+        for (int i = 0; i < count;) {
+            int n = 0;
+            while (n < 16 && i + n < count) {
+                batch[n] = i + n;
+                ++n;
+            }
+            int pushed = static_cast<int>(q.try_push_n(batch, static_cast<std::size_t>(n)));
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            i += pushed;
+        }
+    });
+    int expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        int value = 0;
+        if (q.try_pop(value)) {
+            ordered = ordered && (value == expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(q.empty());
+}
+
+// s21_mpmc_queue
+TEST(s21_containers, s21_mpmc_queue_push_pop) {
+    s21::mpmc_queue<std::string> q(3);
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.try_push(std::string("a")));
+    EXPECT_TRUE(q.try_emplace(2, 'b'));
+    q.push("c");
+    q.emplace_back("d");
+    EXPECT_FALSE(q.try_push("e"));
+    EXPECT_EQ(q.size(), 4);
+    std::string value;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, "a");
+    q.pop(value);
+    EXPECT_EQ(value, "bb");
+    EXPECT_EQ(q.size(), 2);
+}
+
+TEST(s21_containers, s21_mpmc_queue_threads) {
+    s21::mpmc_queue<long> q(16);
+    long const per_producer = 20000;
+    std::vector<std::thread> threads;
+    std::atomic<long> sum(0);
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&q, per_producer]() {
+            for (long i = 1; i <= per_producer; ++i) {
+                q.push(i);
+            }
+        });
+    }
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([&q, &sum, per_producer]() {
+            for (long i = 0; i < 3 * per_producer / 2; ++i) {
+                long value = 0;
+                q.pop(value);
+                sum += value;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(sum.load(), 3 * per_producer * (per_producer + 1) / 2);
+    EXPECT_TRUE(q.empty());
+}
+
+// s21_fork_join_pool
+static long fork_join_fib(s21::ForkJoinPool &pool, int n) {
+    if (n < 12) {
+        return (n < 2) ? n : fork_join_fib(pool, n - 1) + fork_join_fib(pool, n - 2);
+    }
+    long a = 0;
+    long b = 0;
+    pool.invoke([&]() { a = fork_join_fib(pool, n - 1); }, [&]() { b = fork_join_fib(pool, n - 2); });
+    return a + b;
+}
+
+TEST(s21_containers, s21_fork_join_pool_deque) {
+    s21::WorkStealingDeque<int> d(2);
+    for (int i = 0; i < 100; ++i) {
+        d.push(i);
+    }
+    EXPECT_EQ(d.size(), 100);
+    int value = 0;
+    EXPECT_TRUE(d.pop(value));
+    EXPECT_EQ(value, 99);
+    EXPECT_TRUE(d.steal(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_EQ(d.size(), 98);
+    while (d.pop(value)) {
+    }
+    EXPECT_TRUE(d.empty());
+    EXPECT_FALSE(d.steal(value));
+}
+
+TEST(s21_containers, s21_fork_join_pool_steal) {
+    s21::WorkStealingDeque<long> d;
+    long const count = 100000;
+    std::atomic<long> sum(0);
+    std::atomic<long> taken(0);
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&]() {
+            while (taken.load() < count) {
+                long value = 0;
+                if (d.steal(value)) {
+                    sum += value;
+                    ++taken;
+                }
+            }
+        });
+    }
+    for (long i = 1; i <= count; ++i) {
+        d.push(i);
+        long value = 0;
+        if (i % 3 == 0 && d.pop(value)) {
+            sum += value;
+            ++taken;
+        }
+    }
+    for (auto &thread : thieves) {
+        thread.join();
+    }
+    EXPECT_EQ(sum.load(), count * (count + 1) / 2);
+    EXPECT_TRUE(d.empty());
+}
+
+TEST(s21_containers, s21_fork_join_pool_invoke) {
+    s21::ForkJoinPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+    EXPECT_EQ(fork_join_fib(pool, 25), 75025);
+    EXPECT_EQ(fork_join_fib(s21::ForkJoinPool::instance(), 20), 6765);
+}
+
+TEST(s21_containers, s21_fork_join_pool_exception) {
+    s21::ForkJoinPool pool(2);
+    bool ran = false;
+    EXPECT_THROW(pool.invoke([&]() { ran = true; }, []() { throw std::out_of_range("forked"); }),
+                 std::out_of_range);
+    EXPECT_TRUE(ran);
+    EXPECT_THROW(pool.invoke([]() { throw std::out_of_range("left"); }, []() {}), std::out_of_range);
+}
+
+// s21_concurrent_stack
+TEST(s21_containers, s21_concurrent_stack_push_pop) {
+    s21::concurrent_stack<std::string> s{"a", "b"};
+    EXPECT_FALSE(s.empty());
+    s.push(std::string("c"));
+    s.emplace_front(2, 'd');
+    std::string value;
+    EXPECT_TRUE(s.try_pop(value));
+    EXPECT_EQ(value, "dd");
+    EXPECT_TRUE(s.try_pop(value));
+    EXPECT_EQ(value, "c");
+    EXPECT_TRUE(s.try_pop(value));
+    EXPECT_EQ(value, "b");
+    s.clear();
+    EXPECT_TRUE(s.empty());
+    EXPECT_FALSE(s.try_pop(value));
+}
+
+template <bool Elimination>
+static void concurrent_stack_threads() {
+    s21::concurrent_stack<long, Elimination> s;
+    long const per_thread = 20000;
+    std::atomic<long> sum(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&s, &sum, per_thread]() {
+            for (long i = 1; i <= per_thread; ++i) {
+                s.push(i);
+                long value = 0;
+                if (i % 2 == 0 && s.try_pop(value)) {
+                    sum += value;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    long value = 0;
+    while (s.try_pop(value)) {
+        sum += value;
+    }
+    EXPECT_EQ(sum.load(), 4 * per_thread * (per_thread + 1) / 2);
+}
+
+TEST(s21_containers, s21_concurrent_stack_threads) {
+    concurrent_stack_threads<true>();
+    concurrent_stack_threads<false>();
+}
+
+// s21_blocking_queue
+TEST(s21_containers, s21_blocking_queue_batch) {
+    s21::blocking_queue<int> q(4);
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_TRUE(q.push(1));
+    std::vector<int> in{2, 3};
+    EXPECT_EQ(q.push_batch(in.begin(), in.end()), 2);
+    EXPECT_TRUE(q.try_push(4));
+    EXPECT_FALSE(q.try_push(5));
+    EXPECT_EQ(q.size(), 4);
+    std::vector<int> out;
+    EXPECT_EQ(q.pop_batch(std::back_inserter(out), 3, std::chrono::milliseconds(0)), 3);
+    EXPECT_EQ(out, std::vector<int>({1, 2, 3}));
+    int value = 0;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, 4);
+    EXPECT_EQ(q.pop_batch(std::back_inserter(out), 3, std::chrono::milliseconds(1)), 0);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(s21_containers, s21_blocking_queue_close) {
+    s21::blocking_queue<std::string> q(8);
+    q.push("a");
+    q.push(std::string("b"));
+    q.close();
+    EXPECT_TRUE(q.closed());
+    EXPECT_FALSE(q.push("c"));
+    EXPECT_FALSE(q.try_push("c"));
+    std::string value;
+    EXPECT_TRUE(q.pop(value));
+    EXPECT_EQ(value, "a");
+    std::vector<std::string> out;
+    EXPECT_EQ(q.pop_batch(std::back_inserter(out), 8), 1);
+    EXPECT_EQ(out.back(), "b");
+    EXPECT_FALSE(q.pop(value));
+    EXPECT_EQ(q.pop_batch(std::back_inserter(out), 8), 0);
+}
+
+TEST(s21_containers, s21_blocking_queue_threads) {
+    s21::blocking_queue<long> q(64);
+    long const per_producer = 20000;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 3; ++t) {
+        producers.emplace_back([&q, per_producer]() {
+            std::vector<long> batch;
+            for (long i = 1; i <= per_producer; ++i) {
+                batch.push_back(i);
+                if (batch.size() == 100) {
+                    q.push_batch(batch.begin(), batch.end());
+                    batch.clear();
+                }
+            }
+            q.push_batch(batch.begin(), batch.end());
+        });
+    }
+    std::atomic<long> sum(0);
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 2; ++t) {
+        consumers.emplace_back([&q, &sum]() {
+            std::vector<long> batch;
+            while (q.pop_batch(std::back_inserter(batch), 32) > 0) {
+                for (long value : batch) {
+                    sum += value;
+                }
+                batch.clear();
+            }
+        });
+    }
+    for (auto &thread : producers) {
+        thread.join();
+    }
+    q.close();
+    for (auto &thread : consumers) {
+        thread.join();
+    }
+    EXPECT_EQ(sum.load(), 3 * per_producer * (per_producer + 1) / 2);
+}
+
+// s21_priority_queue
+TEST(s21_containers, s21_priority_queue_push_pop) {
+    s21::priority_queue<int> q;
+    EXPECT_TRUE(q.empty());
+    for (int value : {5, 1, 8, 3, 9, 2}) {
+        q.push(value);
+    }
+    EXPECT_EQ(q.size(), 6);
+    std::vector<int> out;
+    while (!q.empty()) {
+        out.push_back(q.top());
+        q.pop();
+    }
+    EXPECT_EQ(out, std::vector<int>({9, 8, 5, 3, 2, 1}));
+}
+
+TEST(s21_containers, s21_priority_queue_heapify) {
+    std::vector<int> in;
+    for (int i = 0; i < 1000; ++i) {
+        in.push_back((i * 7919) % 1000);
+    }
+    s21::priority_queue<int, s21::vector<int>, std::greater<int>, 4> q(in.begin(), in.end());
+    EXPECT_EQ(q.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(q.top(), i);
+        q.pop();
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(s21_containers, s21_priority_queue_emplace) {
+    using event = std::pair<int, std::string>;
+    s21::priority_queue<event, std::vector<event>> q{{1, "a"}};
+    q.emplace(3, "c");
+    q.push(std::make_pair(2, std::string("b")));
+    s21::priority_queue<event, std::vector<event>> moved(std::move(q));
+    EXPECT_EQ(moved.top().second, "c");
+    moved.pop();
+    EXPECT_EQ(moved.top().second, "b");
+    EXPECT_EQ(moved.size(), 2);
+}
+
+// s21_indexed_priority_queue
+TEST(s21_containers, s21_indexed_priority_queue_push_pop) {
+    s21::indexed_priority_queue<int> q(4);
+    q.push(0, 50);
+    q.push(3, 10);
+    q.push(7, 30);
+    EXPECT_EQ(q.size(), 3);
+    EXPECT_TRUE(q.contains(7));
+    EXPECT_FALSE(q.contains(1));
+    EXPECT_FALSE(q.contains(100));
+    EXPECT_THROW(q.push(3, 1), std::invalid_argument);
+    EXPECT_EQ(q.top().first, 3);
+    EXPECT_EQ(q.top().second, 10);
+    q.pop();
+    EXPECT_FALSE(q.contains(3));
+    EXPECT_EQ(q.top().first, 7);
+    EXPECT_EQ(q.key(0), 50);
+}
+
+TEST(s21_containers, s21_indexed_priority_queue_decrease_key) {
+    s21::indexed_priority_queue<int, std::less<int>, 2> q;
+    for (int id = 0; id < 100; ++id) {
+        q.push(static_cast<std::size_t>(id), 1000 + id);
+    }
+    q.decrease_key(42, 5);
+    EXPECT_EQ(q.top().first, 42);
+    EXPECT_THROW(q.decrease_key(42, 6), std::invalid_argument);
+    EXPECT_THROW(q.decrease_key(100, 6), std::out_of_range);
+    q.update(42, 2000);
+    EXPECT_EQ(q.top().first, 0);
+    EXPECT_EQ(q.erase(0), 1);
+    EXPECT_EQ(q.erase(0), 0);
+    int last = 0;
+    while (!q.empty()) {
+        EXPECT_LE(last, q.top().second);
+        last = q.top().second;
+        q.pop();
+    }
+    EXPECT_EQ(last, 2000);
+}
+
+// s21_container_stats
+TEST(s21_containers, s21_container_stats_counters) {
+    s21::vector<int> v;
+    s21::set<int> tree;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+        tree.insert(i);
+    }
+    s21::container_stats before = tree.stats();
+    s21::set<int> copy(tree);
+    copy.insert(100);
+    s21::container_stats delta = copy.stats() - before;
+#ifdef S21_CONTAINER_STATS
+    EXPECT_EQ(v.stats().copies, 100);
+    EXPECT_GE(v.stats().reallocations, 1);
+    EXPECT_EQ(v.stats().allocations, v.stats().reallocations + 1);
+    EXPECT_EQ(tree.stats().copies, 100);
+    EXPECT_EQ(tree.stats().allocations, 101);
+    EXPECT_GT(tree.stats().rotations, 0);
+    EXPECT_GT(tree.stats().comparisons, 0);
+    EXPECT_EQ(copy.stats().copies, 101);
+    EXPECT_EQ(delta.copies, 1);
+#else
+    EXPECT_EQ(v.stats().copies, 0);
+    EXPECT_EQ(tree.stats().rotations, 0);
+    EXPECT_EQ(delta.copies, 0);
+#endif
+}
+
+TEST(s21_containers, s21_container_stats_dump) {
+    s21::list<int> l({1, 2, 3});
+    s21::queue<int> q({1, 2});
+    std::ostringstream out;
+    s21::dump(out, "list", l.stats());
+    s21::dump(out, "queue", q.stats());
+#ifdef S21_CONTAINER_STATS
+    EXPECT_EQ(out.str(),
+              "list: allocations=4 reallocations=0 copies=3 comparisons=0 rotations=0\n"
+              "queue: allocations=3 reallocations=0 copies=2 comparisons=0 rotations=0\n");
+#else
+    EXPECT_EQ(out.str(),
+              "list: allocations=0 reallocations=0 copies=0 comparisons=0 rotations=0\n"
+              "queue: allocations=0 reallocations=0 copies=0 comparisons=0 rotations=0\n");
+#endif
+}
+
+// s21_memory_usage
+TEST(s21_containers, s21_memory_usage_vector) {
+    s21::vector<int> v;
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(i);
+    }
+    s21::memory_footprint usage = v.memory_usage();
+    EXPECT_EQ(usage.payload, 10 * sizeof(int));
+    EXPECT_EQ(usage.slack, (v.capacity() - 10) * sizeof(int));
+    EXPECT_EQ(usage.metadata, sizeof(v));
+    EXPECT_GT(usage.overhead, 0);
+    EXPECT_EQ(usage.total(), usage.payload + usage.metadata + usage.slack + usage.overhead);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.memory_usage().slack, 0);
+}
+
+TEST(s21_containers, s21_memory_usage_nodes) {
+    s21::list<int> l({1, 2, 3});
+    s21::map<int, std::string> m({{1, "a"}, {2, "b"}});
+    s21::array<int, 4> a;
+    s21::frozen_set<int> f({5, 1, 3});
+    EXPECT_EQ(l.memory_usage().payload, 3 * sizeof(int));
+    EXPECT_GT(l.memory_usage().metadata, sizeof(l) + 3 * 2 * sizeof(void *));
+    EXPECT_EQ(m.memory_usage().payload, 2 * sizeof(std::pair<const int, std::string>));
+    EXPECT_EQ(a.memory_usage().payload, 4 * sizeof(int));
+    EXPECT_EQ(a.memory_usage().total(), sizeof(a));
+    EXPECT_EQ(f.memory_usage().payload, 3 * sizeof(int));
+    EXPECT_EQ(f.memory_usage().slack, sizeof(int));
+    s21::memory_footprint empty = s21::list<int>().memory_usage();
+    EXPECT_EQ(empty.payload, 0);
+    EXPECT_GT(empty.metadata, 0);
+}
+
+TEST(s21_containers, s21_memory_usage_concurrent) {
+    s21::concurrent_set<int> s({1, 2, 3});
+    s21::concurrent_stack<int> st({1, 2});
+    s21::mpmc_queue<int> q(8);
+    q.push(1);
+    s21::persistent_map<int, int> v1({{1, 1}});
+    s21::persistent_map<int, int> v2 = v1.insert(2, 2);
+    s21::sharded_map<int, int, 4> sm;
+    sm.insert(1, 1);
+    s21::indexed_priority_queue<int> pq(16);
+    pq.push(3, 1);
+    EXPECT_EQ(s.memory_usage().payload, 3 * sizeof(int));
+    EXPECT_EQ(st.memory_usage().payload, 2 * sizeof(int));
+    EXPECT_EQ(q.memory_usage().payload, sizeof(int));
+    EXPECT_EQ(q.memory_usage().slack, (q.capacity() - 1) * sizeof(int));
+    EXPECT_EQ(v2.memory_usage().payload, 2 * sizeof(std::pair<const int, int>));
+    EXPECT_EQ(sm.memory_usage().payload, sizeof(std::pair<const int, int>));
+    EXPECT_EQ(pq.memory_usage().payload, sizeof(std::pair<std::size_t, int>));
+    EXPECT_GE(pq.memory_usage().metadata, 16 * sizeof(std::size_t));
+}
+
+TEST(s21_containers, s21_memory_usage_tracker) {
+    s21::memory_tracker::usage before = s21::memory_tracker::instance().find("list");
+    {
+        s21::list<int> l({1, 2, 3});
+        s21::memory_tracker::usage during = s21::memory_tracker::instance().find("list");
+#ifdef S21_MEMORY_TRACKING
+        EXPECT_EQ(during.blocks - before.blocks, 4);
+        EXPECT_GE(during.peak_bytes, during.bytes);
+#else
+        EXPECT_EQ(during.blocks, 0);
+#endif
+    }
+    EXPECT_EQ(s21::memory_tracker::instance().find("list").bytes, before.bytes);
+    std::ostringstream out;
+    s21::memory_tracker::instance().dump(out);
+#ifdef S21_MEMORY_TRACKING
+    EXPECT_NE(out.str().find("list: bytes="), std::string::npos);
+#else
+    EXPECT_TRUE(out.str().empty());
+#endif
+}
+
+// s21_unrolled_list
+TEST(s21_containers, s21_unrolled_list_push_pop) {
+    s21::unrolled_list<int, 4> l;
+    for (int i = 0; i < 10; ++i) {
+        l.push_back(i);
+        l.push_front(-i - 1);
+    }
+    EXPECT_EQ(l.size(), 20);
+    EXPECT_EQ(l.front(), -10);
+    EXPECT_EQ(l.back(), 9);
+    int expected = -10;
+    for (auto it = l.begin(); it != l.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+    for (auto it = l.end(); it != l.begin();) {
+        EXPECT_EQ(*--it, --expected);
+    }
+    for (int i = 0; i < 10; ++i) {
+        l.pop_back();
+        l.pop_front();
+    }
+    EXPECT_TRUE(l.empty());
+    EXPECT_EQ(l.blocks(), 0);
+    EXPECT_TRUE(l.begin() == l.end());
+}
+
+TEST(s21_containers, s21_unrolled_list_insert_erase) {
+    s21::unrolled_list<int, 8> l;
+    std::vector<int> mirror;
+    for (int i = 0; i < 500; ++i) {
+        std::size_t at = (static_cast<std::size_t>(i) * 37) % (mirror.size() + 1);
+        auto it = l.begin();
+        for (std::size_t k = 0; k < at; ++k) {
+            ++it;
+        }
+        EXPECT_EQ(*l.insert(it, i), i);
+        mirror.insert(mirror.begin() + static_cast<std::ptrdiff_t>(at), i);
+    }
+    for (int i = 0; i < 300; ++i) {
+        std::size_t at = (static_cast<std::size_t>(i) * 53) % mirror.size();
+        auto it = l.begin();
+        for (std::size_t k = 0; k < at; ++k) {
+            ++it;
+        }
+        it = l.erase(it);
+        mirror.erase(mirror.begin() + static_cast<std::ptrdiff_t>(at));
+        if (at < mirror.size()) {
+            EXPECT_EQ(*it, mirror[at]);
+        } else {
+            EXPECT_TRUE(it == l.end());
+        }
+    }
+    ASSERT_EQ(l.size(), mirror.size());
+    std::size_t i = 0;
+    for (int value : l) {
+        EXPECT_EQ(value, mirror[i++]);
+    }
+    EXPECT_LT(l.blocks(), l.size() / 2);
+}
+
+TEST(s21_containers, s21_unrolled_list_copy_move) {
+    s21::unrolled_list<std::string> l({"a", "b", "c"});
+    s21::unrolled_list<std::string> copy(l);
+    copy.push_back("d");
+    s21::unrolled_list<std::string> moved(std::move(copy));
+    EXPECT_EQ(l.size(), 3);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 4);
+    EXPECT_EQ(moved.back(), "d");
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    s21::unrolled_list<int> zeros(5);
+    EXPECT_EQ(zeros.size(), 5);
+    EXPECT_EQ(zeros.front(), 0);
+}
+
+TEST(s21_containers, s21_unrolled_list_memory_usage) {
+    s21::unrolled_list<int, 16> l;
+    for (int i = 0; i < 160; ++i) {
+        l.push_back(i);
+    }
+    EXPECT_EQ(l.blocks(), 10);
+    s21::memory_footprint usage = l.memory_usage();
+    EXPECT_EQ(usage.payload, 160 * sizeof(int));
+    EXPECT_EQ(usage.slack, 0);
+    EXPECT_LT(usage.total(), s21::list<int>(160).memory_usage().total());
+}
+
+struct unrolled_item {
+    static int copies_left;
+    std::string text;
+
+    explicit unrolled_item(std::string const &t) : text(t) {}
+    unrolled_item(unrolled_item const &other) : text(other.text) {
+        if (copies_left == 0) {
+            throw std::runtime_error("unrolled_item copy");
+        }
+        --copies_left;
+    }
+    unrolled_item(unrolled_item &&other) noexcept = default;
+    unrolled_item &operator=(unrolled_item &&other) noexcept = default;
+};
+
+int unrolled_item::copies_left = 0;
+
+TEST(s21_containers, s21_unrolled_list_throwing_copy) {
+    unrolled_item::copies_left = 100;
+    s21::unrolled_list<unrolled_item, 4> l;
+    for (int i = 0; i < 6; ++i) {
+        l.push_back(unrolled_item(std::to_string(i)));
+    }
+    unrolled_item extra("x");
+    unrolled_item::copies_left = 0;
+    std::size_t blocks = l.blocks();
+    EXPECT_THROW(l.insert(++l.begin(), extra), std::runtime_error);
+    EXPECT_THROW(l.push_back(extra), std::runtime_error);
+    EXPECT_THROW(l.push_front(extra), std::runtime_error);
+    EXPECT_EQ(l.size(), 6);
+    EXPECT_EQ(l.blocks(), blocks);
+    int i = 0;
+    for (auto const &item : l) {
+        EXPECT_EQ(item.text, std::to_string(i++));
+    }
+    s21::unrolled_list<unrolled_item, 4> empty;
+    EXPECT_THROW(empty.push_back(extra), std::runtime_error);
+    EXPECT_TRUE(empty.begin() == empty.end());
+    EXPECT_EQ(empty.blocks(), 0);
+    unrolled_item::copies_left = 100;
+    l.insert(++l.begin(), extra);
+    EXPECT_EQ((*++l.begin()).text, "x");
+    EXPECT_EQ(l.size(), 7);
+    l.push_front(extra);
+    EXPECT_EQ(l.front().text, "x");
+    EXPECT_EQ(l.size(), 8);
+}
+
+// s21_intrusive_list
+struct intrusive_entry {
+    int key;
+    s21::intrusive_list_hook lru;
+    s21::intrusive_list_hook queue;
+
+    explicit intrusive_entry(int k) : key(k) {}
+};
+
+using lru_list = s21::intrusive_list<intrusive_entry, &intrusive_entry::lru>;
+using queue_list = s21::intrusive_list<intrusive_entry, &intrusive_entry::queue>;
+
+TEST(s21_containers, s21_intrusive_list_two_lists) {
+    std::vector<intrusive_entry> entries;
+    for (int i = 0; i < 6; ++i) {
+        entries.emplace_back(i);
+    }
+    lru_list lru;
+    queue_list queue;
+    for (auto &e : entries) {
+        lru.push_front(e);
+        if (e.key % 2 == 0) {
+            queue.push_back(e);
+        }
+    }
+    EXPECT_EQ(lru.size(), 6);
+    EXPECT_EQ(queue.size(), 3);
+    EXPECT_EQ(lru.front().key, 5);
+    EXPECT_EQ(queue.back().key, 4);
+    lru.erase(entries[2]);
+    EXPECT_FALSE(entries[2].lru.is_linked());
+    EXPECT_TRUE(entries[2].queue.is_linked());
+    lru.erase(lru.iterator_to(entries[0]));
+    lru.push_front(entries[0]);
+    int lru_order[] = {0, 5, 4, 3, 1};
+    int i = 0;
+    for (auto const &e : lru) {
+        EXPECT_EQ(e.key, lru_order[i++]);
+    }
+    int queue_order[] = {0, 2, 4};
+    i = 0;
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+        EXPECT_EQ((*it).key, queue_order[i++]);
+    }
+    queue.pop_front();
+    EXPECT_EQ(queue.front().key, 2);
+    EXPECT_EQ((*--queue.end()).key, 4);
+    lru.clear();
+    EXPECT_TRUE(lru.empty());
+    EXPECT_FALSE(entries[5].lru.is_linked());
+    queue.clear();
+}
+
+TEST(s21_containers, s21_intrusive_list_move_splice) {
+    intrusive_entry a(1), b(2), c(3), d(4);
+    lru_list first;
+    first.push_back(a);
+    first.push_back(b);
+    lru_list second(std::move(first));
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(second.size(), 2);
+    first.push_back(c);
+    first.push_back(d);
+    first.swap(second);
+    EXPECT_EQ(first.front().key, 1);
+    EXPECT_EQ(second.front().key, 3);
+    first.splice(++first.begin(), second);
+    EXPECT_TRUE(second.empty());
+    int order[] = {1, 3, 4, 2};
+    int i = 0;
+    for (auto const &e : first) {
+        EXPECT_EQ(e.key, order[i++]);
+    }
+    for (int key : {2, 4, 3, 1}) {
+        EXPECT_EQ(first.back().key, key);
+        first.pop_back();
+    }
+    EXPECT_FALSE(a.lru.is_linked());
+    EXPECT_TRUE(first.empty());
+    second = std::move(first);
+    EXPECT_EQ(second.memory_usage().payload, 0);
+}
+
 int main(int argc, char* argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
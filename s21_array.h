@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <utility>
 
+#include "MemoryUsage.h"
+
 namespace s21 {
 template <typename T, std::size_t N>
 struct array {
@@ -45,6 +47,8 @@ struct array {
     void swap(array &other);
     void fill(const_reference value);
 
+    memory_footprint memory_usage() const;
+
  private:
     T _head[N + 1];
 };
@@ -177,6 +181,15 @@ template <typename T, std::size_t N>
 void array<T, N>::fill(const_reference value) {
     std::fill_n(begin(), size(), value);
 }
+
+template <typename T, std::size_t N>
+memory_footprint array<T, N>::memory_usage() const {
+    /*  the elements live inside the object, past-the-end slot included  */
+    memory_footprint usage;
+    usage.payload = N * sizeof(T);
+    usage.slack = sizeof(*this) - usage.payload;
+    return usage;
+}
 }  // namespace s21
 
 #endif  // SRC_S21_ARRAY_H_
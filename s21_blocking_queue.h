@@ -0,0 +1,317 @@
+#ifndef SRC_S21_BLOCKING_QUEUE_H_
+#define SRC_S21_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  bounded blocking queue for pipeline stages. the elements live in one
+ * contiguous ring behind a single mutex, push_batch() and pop_batch() move
+ * a whole run of elements per lock and wake the other side once per run,
+ * so the synchronization cost is shared by the batch. a full queue makes
+ * producers wait (backpressure). after close() pushes fail, consumers get
+ * the remaining elements and then an empty result instead of waiting  */
+template <class T>
+struct blocking_queue {
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+    explicit blocking_queue(size_type capacity);
+    blocking_queue(blocking_queue const &q) = delete;
+    ~blocking_queue();
+
+    blocking_queue &operator=(blocking_queue const &q) = delete;
+
+    bool empty() const;
+    size_type size() const;
+    size_type capacity() const noexcept;
+    memory_footprint memory_usage() const;
+
+    void close();
+    bool closed() const;
+
+    /*  block while full, false once the queue is closed  */
+    bool push(const_reference value);
+    bool push(value_type &&value);
+    /*  pushes as many elements as fit per lock, blocking in between until
+     * all are pushed or the queue is closed. returns how many were pushed  */
+    template <typename InputIt>
+    size_type push_batch(InputIt first, InputIt last);
+    bool try_push(const_reference value);
+
+    /*  block while empty, false once the queue is closed and drained  */
+    bool pop(reference value);
+    /*  waits up to timeout for at least one element and takes up to max_n.
+     * returns 0 on timeout or when the queue is closed and drained  */
+    template <typename OutputIt, typename Rep, typename Period>
+    size_type pop_batch(OutputIt out, size_type max_n, std::chrono::duration<Rep, Period> const &timeout);
+    template <typename OutputIt>
+    size_type pop_batch(OutputIt out, size_type max_n);
+    bool try_pop(reference value);
+
+ private:
+    size_type _capacity;
+    size_type _head;
+    size_type _count;
+    T *_ring;
+    bool _closed;
+
+    std::allocator<T> _a;
+    using _Blocking_queue_manager = std::allocator_traits<std::allocator<T>>;
+
+    mutable std::mutex _lock;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    size_type _waiting_consumers;
+    size_type _waiting_producers;
+
+    size_type _slot(size_type i) const noexcept;
+    template <typename... Args>
+    void _emplace(Args &&...args);
+    template <typename OutputIt>
+    size_type _take(OutputIt &out, size_type max_n);
+    template <typename U>
+    bool _push_one(U &&value);
+    void _wait_for_room(std::unique_lock<std::mutex> &lock);
+};
+
+template <typename T>
+blocking_queue<T>::blocking_queue(size_type capacity)
+    : _capacity(capacity > 0 ? capacity : 1),
+      _head(0),
+      _count(0),
+      _ring(nullptr),
+      _closed(false),
+      _waiting_consumers(0),
+      _waiting_producers(0) {
+    _ring = _Blocking_queue_manager::allocate(_a, _capacity);
+    S21_TRACK_ALLOCATED("blocking_queue", _capacity * sizeof(T));
+}
+
+template <typename T>
+blocking_queue<T>::~blocking_queue() {
+    for (size_type i = 0; i < _count; ++i) {
+        _Blocking_queue_manager::destroy(_a, _ring + _slot(i));
+    }
+    _Blocking_queue_manager::deallocate(_a, _ring, _capacity);
+    S21_TRACK_RELEASED("blocking_queue", _capacity * sizeof(T));
+}
+
+template <typename T>
+bool blocking_queue<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+typename blocking_queue<T>::size_type blocking_queue<T>::size() const {
+    std::lock_guard<std::mutex> lock(_lock);
+    return _count;
+}
+
+template <typename T>
+typename blocking_queue<T>::size_type blocking_queue<T>::capacity() const noexcept {
+    return _capacity;
+}
+
+template <typename T>
+memory_footprint blocking_queue<T>::memory_usage() const {
+    std::lock_guard<std::mutex> lock(_lock);
+    memory_footprint usage = buffer_footprint(_count, _capacity, sizeof(T));
+    usage.metadata += sizeof(*this);
+    return usage;
+}
+
+template <typename T>
+void blocking_queue<T>::close() {
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _closed = true;
+    }
+    _not_empty.notify_all();
+    _not_full.notify_all();
+}
+
+template <typename T>
+bool blocking_queue<T>::closed() const {
+    std::lock_guard<std::mutex> lock(_lock);
+    return _closed;
+}
+
+template <typename T>
+bool blocking_queue<T>::push(const_reference value) {
+    return _push_one(value);
+}
+
+template <typename T>
+bool blocking_queue<T>::push(value_type &&value) {
+    return _push_one(std::move(value));
+}
+
+template <typename T>
+template <typename U>
+bool blocking_queue<T>::_push_one(U &&value) {
+    std::unique_lock<std::mutex> lock(_lock);
+    _wait_for_room(lock);
+    if (_closed) {
+        return false;
+    }
+    _emplace(std::forward<U>(value));
+    bool wake = _waiting_consumers > 0;
+    lock.unlock();
+    if (wake) {
+        _not_empty.notify_one();
+    }
+    return true;
+}
+
+template <typename T>
+template <typename InputIt>
+typename blocking_queue<T>::size_type blocking_queue<T>::push_batch(InputIt first, InputIt last) {
+    size_type pushed = 0;
+    std::unique_lock<std::mutex> lock(_lock);
+    while (first != last) {
+        _wait_for_room(lock);
+        if (_closed) {
+            break;
+        }
+        size_type run = 0;
+        for (; first != last && _count < _capacity; ++first, ++run) {
+            _emplace(*first);
+        }
+        pushed += run;
+        if (_waiting_consumers > 0) {
+            /*  several consumers may be waiting for a run this long  */
+            lock.unlock();
+            if (run > 1) {
+                _not_empty.notify_all();
+            } else {
+                _not_empty.notify_one();
+            }
+            lock.lock();
+        }
+    }
+    return pushed;
+}
+
+template <typename T>
+bool blocking_queue<T>::try_push(const_reference value) {
+    std::unique_lock<std::mutex> lock(_lock);
+    if (_closed || _count == _capacity) {
+        return false;
+    }
+    _emplace(value);
+    bool wake = _waiting_consumers > 0;
+    lock.unlock();
+    if (wake) {
+        _not_empty.notify_one();
+    }
+    return true;
+}
+
+template <typename T>
+bool blocking_queue<T>::pop(reference value) {
+    std::unique_lock<std::mutex> lock(_lock);
+    ++_waiting_consumers;
+    _not_empty.wait(lock, [this]() { return _count > 0 || _closed; });
+    --_waiting_consumers;
+    value_type *out = &value;
+    bool popped = _take(out, 1) > 0;
+    bool wake = popped && _waiting_producers > 0;
+    lock.unlock();
+    if (wake) {
+        _not_full.notify_one();
+    }
+    return popped;
+}
+
+template <typename T>
+template <typename OutputIt, typename Rep, typename Period>
+typename blocking_queue<T>::size_type blocking_queue<T>::pop_batch(
+    OutputIt out, size_type max_n, std::chrono::duration<Rep, Period> const &timeout) {
+    std::unique_lock<std::mutex> lock(_lock);
+    ++_waiting_consumers;
+    _not_empty.wait_for(lock, timeout, [this]() { return _count > 0 || _closed; });
+    --_waiting_consumers;
+    size_type popped = _take(out, max_n);
+    bool wake = popped > 0 && _waiting_producers > 0;
+    lock.unlock();
+    if (wake) {
+        _not_full.notify_all();
+    }
+    return popped;
+}
+
+template <typename T>
+template <typename OutputIt>
+typename blocking_queue<T>::size_type blocking_queue<T>::pop_batch(OutputIt out, size_type max_n) {
+    std::unique_lock<std::mutex> lock(_lock);
+    ++_waiting_consumers;
+    _not_empty.wait(lock, [this]() { return _count > 0 || _closed; });
+    --_waiting_consumers;
+    size_type popped = _take(out, max_n);
+    bool wake = popped > 0 && _waiting_producers > 0;
+    lock.unlock();
+    if (wake) {
+        _not_full.notify_all();
+    }
+    return popped;
+}
+
+template <typename T>
+bool blocking_queue<T>::try_pop(reference value) {
+    std::unique_lock<std::mutex> lock(_lock);
+    value_type *out = &value;
+    bool popped = _take(out, 1) > 0;
+    bool wake = popped && _waiting_producers > 0;
+    lock.unlock();
+    if (wake) {
+        _not_full.notify_one();
+    }
+    return popped;
+}
+
+template <typename T>
+typename blocking_queue<T>::size_type blocking_queue<T>::_slot(size_type i) const noexcept {
+    size_type slot = _head + i;
+    return (slot >= _capacity) ? slot - _capacity : slot;
+}
+
+template <typename T>
+template <typename... Args>
+void blocking_queue<T>::_emplace(Args &&...args) {
+    _Blocking_queue_manager::construct(_a, _ring + _slot(_count), std::forward<Args>(args)...);
+    ++_count;
+}
+
+template <typename T>
+template <typename OutputIt>
+typename blocking_queue<T>::size_type blocking_queue<T>::_take(OutputIt &out, size_type max_n) {
+    size_type taken = (_count < max_n) ? _count : max_n;
+    for (size_type i = 0; i < taken; ++i, ++out) {
+        T *slot = _ring + _head;
+        *out = std::move(*slot);
+        _Blocking_queue_manager::destroy(_a, slot);
+        if (++_head == _capacity) {
+            _head = 0;
+        }
+    }
+    _count -= taken;
+    return taken;
+}
+
+template <typename T>
+void blocking_queue<T>::_wait_for_room(std::unique_lock<std::mutex> &lock) {
+    ++_waiting_producers;
+    _not_full.wait(lock, [this]() { return _count < _capacity || _closed; });
+    --_waiting_producers;
+}
+}  // namespace s21
+
+#endif  // SRC_S21_BLOCKING_QUEUE_H_
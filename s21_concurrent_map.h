@@ -0,0 +1,116 @@
+#ifndef SRC_S21_CONCURRENT_MAP_H_
+#define SRC_S21_CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include "EpochReclamation.h"
+#include "s21_persistent_map.h"
+
+namespace s21 {
+/*  read-mostly map shared between threads. the contents are a persistent_map
+ * version behind one atomic pointer: readers pin an epoch and read whatever
+ * version is current without taking a lock or doing any atomic
+ * read-modify-write, writers take turns on a mutex, publish an updated
+ * version and retire the old one to EpochReclamation  */
+template <class Key, class T>
+class concurrent_map {
+ public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+    using snapshot_type = persistent_map<Key, T>;
+
+    concurrent_map() : _current(new snapshot_type()) {}
+    explicit concurrent_map(std::initializer_list<value_type> const &items)
+        : _current(new snapshot_type(items)) {}
+    concurrent_map(const concurrent_map &m) : _current(new snapshot_type(m.snapshot())) {}
+    ~concurrent_map() { delete _current.load(std::memory_order_relaxed); }
+    concurrent_map &operator=(const concurrent_map &m) = delete;
+
+    bool empty() const {
+        EpochReclamation::guard guard;
+        return _current.load(std::memory_order_acquire)->empty();
+    }
+    size_type size() const {
+        EpochReclamation::guard guard;
+        return _current.load(std::memory_order_acquire)->size();
+    }
+    size_type max_size() const noexcept { return snapshot_type().max_size(); }
+    /*  the current version only, older ones waiting for reclamation are not
+     * counted  */
+    memory_footprint memory_usage() const {
+        EpochReclamation::guard guard;
+        memory_footprint usage = _current.load(std::memory_order_acquire)->memory_usage();
+        usage.metadata += sizeof(*this);
+        usage.overhead += heap_block_overhead(sizeof(snapshot_type));
+        return usage;
+    }
+
+    /*  copy of the current version, it keeps its contents for as long as it
+     * lives and can be iterated at leisure  */
+    snapshot_type snapshot() const {
+        EpochReclamation::guard guard;
+        return *_current.load(std::memory_order_acquire);
+    }
+
+    mapped_type at(const key_type &key) const {
+        EpochReclamation::guard guard;
+        return _current.load(std::memory_order_acquire)->at(key);
+    }
+    bool contains(const key_type &key) const {
+        EpochReclamation::guard guard;
+        return _current.load(std::memory_order_acquire)->contains(key);
+    }
+    size_type count(const key_type &key) const {
+        EpochReclamation::guard guard;
+        return _current.load(std::memory_order_acquire)->count(key);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(_writer);
+        _publish(new snapshot_type());
+    }
+    bool insert(const value_type &value) { return insert(value.first, value.second); }
+    bool insert(const Key &key, const T &obj) {
+        std::lock_guard<std::mutex> lock(_writer);
+        snapshot_type const *current = _current.load(std::memory_order_relaxed);
+        bool inserted = !current->contains(key);
+        if (inserted) {
+            _publish(new snapshot_type(current->insert(key, obj)));
+        }
+        return inserted;
+    }
+    bool insert_or_assign(const Key &key, const T &obj) {
+        std::lock_guard<std::mutex> lock(_writer);
+        snapshot_type const *current = _current.load(std::memory_order_relaxed);
+        bool inserted = !current->contains(key);
+        _publish(new snapshot_type(current->insert_or_assign(key, obj)));
+        return inserted;
+    }
+    size_type erase(const key_type &key) {
+        std::lock_guard<std::mutex> lock(_writer);
+        snapshot_type const *current = _current.load(std::memory_order_relaxed);
+        size_type erased = current->count(key);
+        if (erased != 0) {
+            _publish(new snapshot_type(current->erase(key)));
+        }
+        return erased;
+    }
+
+ private:
+    std::atomic<snapshot_type *> _current;
+    std::mutex _writer;
+
+    void _publish(snapshot_type *next) {
+        snapshot_type *previous = _current.exchange(next, std::memory_order_acq_rel);
+        EpochReclamation::retire(previous);
+    }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_MAP_H_
@@ -0,0 +1,59 @@
+#ifndef SRC_S21_CONCURRENT_SET_H_
+#define SRC_S21_CONCURRENT_SET_H_
+
+#include <utility>
+
+#include "LockFreeSkipList.h"
+
+namespace s21 {
+/*  ordered set that any number of threads can insert into, erase from and
+ * scan at once, on a lock-free skip list. iteration is weakly consistent:
+ * it sees every element present for the whole scan and may or may not see
+ * the ones inserted or erased meanwhile. iterators pin an epoch and must
+ * stay on the thread that created them  */
+template <class Key>
+class concurrent_set {
+ public:
+    using key_type = Key;
+    using value_type = Key;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using iterator = typename LockFreeSkipList<value_type>::const_iterator;
+    using const_iterator = typename LockFreeSkipList<value_type>::const_iterator;
+    using size_type = std::size_t;
+
+    concurrent_set() {}
+    explicit concurrent_set(double level_probability) : data(level_probability) {}
+    explicit concurrent_set(std::initializer_list<value_type> const &items) {
+        for (auto it = items.begin(); it != items.end(); ++it) {
+            data.insert(*it);
+        }
+    }
+    concurrent_set(const concurrent_set &s) = delete;
+    concurrent_set &operator=(const concurrent_set &s) = delete;
+    ~concurrent_set() {}
+
+    const_iterator begin() const { return data.begin(); }
+    const_iterator end() const { return data.end(); }
+
+    bool empty() const noexcept { return data.empty(); }
+    size_type size() const noexcept { return data.size(); }
+    size_type max_size() const noexcept { return data.max_size(); }
+    double level_probability() const noexcept { return data.level_probability(); }
+    memory_footprint memory_usage() const { return data.memory_usage(); }
+
+    void clear() { data.clear(); }
+    std::pair<iterator, bool> insert(const value_type &value) { return data.insert(value); }
+    size_type erase(const key_type &key) { return data.erase(key); }
+
+    const_iterator find(const key_type &key) const { return data.find(key); }
+    bool contains(const key_type &key) const { return data.contains(key); }
+    const_iterator lower_bound(const key_type &key) const { return data.lower_bound(key); }
+    const_iterator upper_bound(const key_type &key) const { return data.upper_bound(key); }
+
+ private:
+    LockFreeSkipList<value_type> data;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_SET_H_
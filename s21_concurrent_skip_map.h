@@ -0,0 +1,75 @@
+#ifndef SRC_S21_CONCURRENT_SKIP_MAP_H_
+#define SRC_S21_CONCURRENT_SKIP_MAP_H_
+
+#include <stdexcept>
+#include <utility>
+
+#include "LockFreeSkipList.h"
+
+namespace s21 {
+/*  ordered map on the same lock-free skip list as concurrent_set. an
+ * element never changes once inserted, at() hands out a copy of the mapped
+ * value  */
+template <class Key, class T>
+class concurrent_skip_map {
+ public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+
+    struct cmp_pair_by_key {
+        bool operator()(const_reference a, const_reference b) const { return a.first < b.first; }
+    };
+    using iterator = typename LockFreeSkipList<value_type, cmp_pair_by_key>::const_iterator;
+    using const_iterator = typename LockFreeSkipList<value_type, cmp_pair_by_key>::const_iterator;
+    using size_type = std::size_t;
+
+    concurrent_skip_map() {}
+    explicit concurrent_skip_map(double level_probability) : data(level_probability) {}
+    explicit concurrent_skip_map(std::initializer_list<value_type> const &items) {
+        for (auto it = items.begin(); it != items.end(); ++it) {
+            data.insert(*it);
+        }
+    }
+    concurrent_skip_map(const concurrent_skip_map &m) = delete;
+    concurrent_skip_map &operator=(const concurrent_skip_map &m) = delete;
+    ~concurrent_skip_map() {}
+
+    const_iterator begin() const { return data.begin(); }
+    const_iterator end() const { return data.end(); }
+
+    bool empty() const noexcept { return data.empty(); }
+    size_type size() const noexcept { return data.size(); }
+    size_type max_size() const noexcept { return data.max_size(); }
+    double level_probability() const noexcept { return data.level_probability(); }
+    memory_footprint memory_usage() const { return data.memory_usage(); }
+
+    void clear() { data.clear(); }
+    std::pair<iterator, bool> insert(const value_type &value) { return data.insert(value); }
+    std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+        return data.insert(value_type(key, obj));
+    }
+    size_type erase(const key_type &key) { return data.erase(_probe(key)); }
+
+    mapped_type at(const key_type &key) const {
+        auto it = data.find(_probe(key));
+        if (it == data.end()) {
+            throw std::out_of_range("no such key in current map");
+        }
+        return it->second;
+    }
+    const_iterator find(const key_type &key) const { return data.find(_probe(key)); }
+    bool contains(const key_type &key) const { return data.contains(_probe(key)); }
+    const_iterator lower_bound(const key_type &key) const { return data.lower_bound(_probe(key)); }
+    const_iterator upper_bound(const key_type &key) const { return data.upper_bound(_probe(key)); }
+
+ private:
+    LockFreeSkipList<value_type, cmp_pair_by_key> data;
+
+    static value_type _probe(const key_type &key) { return value_type(key, mapped_type()); }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_SKIP_MAP_H_
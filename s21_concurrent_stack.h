@@ -0,0 +1,228 @@
+#ifndef SRC_S21_CONCURRENT_STACK_H_
+#define SRC_S21_CONCURRENT_STACK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "EpochReclamation.h"
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  lock-free stack for any number of threads (Treiber stack): push and pop
+ * swing the head with one CAS. a popped node is retired to
+ * EpochReclamation, so its address cannot come back while another popper
+ * that read it is still pinned, which rules out ABA on the head CAS.
+ * with Elimination a thread that loses the head CAS meets a thread doing
+ * the opposite operation in a small array of slots and they hand the value
+ * over without touching the head at all. scheme described here:
+ * https://people.csail.mit.edu/shanir/publications/Lock_Free.pdf */
+template <class T, bool Elimination = true>
+struct concurrent_stack {
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+    concurrent_stack();
+    explicit concurrent_stack(std::initializer_list<value_type> const &items);
+    concurrent_stack(concurrent_stack const &s) = delete;
+    ~concurrent_stack();
+
+    concurrent_stack &operator=(concurrent_stack const &s) = delete;
+
+    bool empty() const;
+
+    void push(const_reference value);
+    void push(value_type &&value);
+    template <typename... Args>
+    void emplace_front(Args &&...args);
+    bool try_pop(reference value);
+    void clear();
+
+    /*  a walk from the head, approximate while other threads push and pop.
+     * popped nodes waiting for reclamation are not counted  */
+    memory_footprint memory_usage() const;
+
+ private:
+    static size_type const _slots = 8;
+    static int const _wait = 128;
+
+    struct _Node {
+        value_type value;
+        _Node *next;
+
+        S21_TRACKED_NODE("concurrent_stack")
+
+        template <typename... Args>
+        explicit _Node(Args &&...args) : value(std::forward<Args>(args)...), next(nullptr) {}
+    };
+
+    struct alignas(64) _Slot {
+        std::atomic<_Node *> node;
+
+        _Slot() : node(nullptr) {}
+    };
+
+    alignas(64) std::atomic<_Node *> _head;
+    _Slot _exchanger[Elimination ? _slots : 1];
+
+    void _push(_Node *node);
+    bool _give(_Node *node);
+    _Node *_take();
+    static size_type _random_slot();
+};
+
+template <typename T, bool Elimination>
+concurrent_stack<T, Elimination>::concurrent_stack() : _head(nullptr) {
+}
+
+template <typename T, bool Elimination>
+concurrent_stack<T, Elimination>::concurrent_stack(std::initializer_list<value_type> const &items)
+    : _head(nullptr) {
+    for (auto it = items.begin(); it != items.end(); ++it) {
+        push(*it);
+    }
+}
+
+template <typename T, bool Elimination>
+concurrent_stack<T, Elimination>::~concurrent_stack() {
+    _Node *node = _head.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+        _Node *next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+template <typename T, bool Elimination>
+bool concurrent_stack<T, Elimination>::empty() const {
+    return _head.load(std::memory_order_acquire) == nullptr;
+}
+
+template <typename T, bool Elimination>
+memory_footprint concurrent_stack<T, Elimination>::memory_usage() const {
+    EpochReclamation::guard guard;
+    size_type count = 0;
+    for (_Node *node = _head.load(std::memory_order_acquire); node != nullptr; node = node->next) {
+        ++count;
+    }
+    memory_footprint usage = node_footprint(count, sizeof(_Node), sizeof(T));
+    usage.metadata += sizeof(*this);
+    return usage;
+}
+
+template <typename T, bool Elimination>
+void concurrent_stack<T, Elimination>::push(const_reference value) {
+    emplace_front(value);
+}
+
+template <typename T, bool Elimination>
+void concurrent_stack<T, Elimination>::push(value_type &&value) {
+    emplace_front(std::move(value));
+}
+
+template <typename T, bool Elimination>
+template <typename... Args>
+void concurrent_stack<T, Elimination>::emplace_front(Args &&...args) {
+    _push(new _Node(std::forward<Args>(args)...));
+}
+
+template <typename T, bool Elimination>
+void concurrent_stack<T, Elimination>::_push(_Node *node) {
+    /*  pushing never dereferences the head, so it needs no guard  */
+    node->next = _head.load(std::memory_order_relaxed);
+    while (!_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+        if (Elimination && _give(node)) {
+            return;
+        }
+    }
+}
+
+template <typename T, bool Elimination>
+bool concurrent_stack<T, Elimination>::try_pop(reference value) {
+    EpochReclamation::guard guard;
+    _Node *node = _head.load(std::memory_order_acquire);
+    while (node != nullptr) {
+        if (_head.compare_exchange_weak(node, node->next, std::memory_order_acquire,
+                                        std::memory_order_acquire)) {
+            break;
+        }
+        if (Elimination && node != nullptr) {
+            _Node *given = _take();
+            if (given != nullptr) {
+                node = given;
+                break;
+            }
+        }
+    }
+    if (node == nullptr) {
+        return false;
+    }
+    value = std::move(node->value);
+    EpochReclamation::retire(node);
+    return true;
+}
+
+template <typename T, bool Elimination>
+void concurrent_stack<T, Elimination>::clear() {
+    EpochReclamation::guard guard;
+    _Node *node = _head.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr) {
+        _Node *next = node->next;
+        EpochReclamation::retire(node);
+        node = next;
+    }
+}
+
+template <typename T, bool Elimination>
+bool concurrent_stack<T, Elimination>::_give(_Node *node) {
+    /*  offers the node in a random slot for a while. taking it back fails
+     * only when a popper has already taken it. the guard keeps a taken node
+     * from being freed and offered again by another pusher under the same
+     * address before the CAS below  */
+    EpochReclamation::guard guard;
+    _Slot &slot = _exchanger[_random_slot()];
+    _Node *expected = nullptr;
+    if (!slot.node.compare_exchange_strong(expected, node, std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+        return false;
+    }
+    for (int i = 0; i < _wait && slot.node.load(std::memory_order_relaxed) == node; ++i) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    expected = node;
+    return !slot.node.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed,
+                                              std::memory_order_relaxed);
+}
+
+template <typename T, bool Elimination>
+typename concurrent_stack<T, Elimination>::_Node *concurrent_stack<T, Elimination>::_take() {
+    /*  the node in the slot stays allocated while this thread is pinned,
+     * even if the pusher took it back meanwhile, so the CAS is ABA-safe  */
+    _Slot &slot = _exchanger[_random_slot()];
+    _Node *node = slot.node.load(std::memory_order_acquire);
+    if (node != nullptr && slot.node.compare_exchange_strong(node, nullptr, std::memory_order_acquire,
+                                                             std::memory_order_relaxed)) {
+        return node;
+    }
+    return nullptr;
+}
+
+template <typename T, bool Elimination>
+typename concurrent_stack<T, Elimination>::size_type concurrent_stack<T, Elimination>::_random_slot() {
+    static thread_local std::uint32_t seed =
+        static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return static_cast<size_type>(seed) % (Elimination ? _slots : 1);
+}
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_STACK_H_
@@ -2,6 +2,22 @@
 #define SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_blocking_queue.h"
+#include "s21_concurrent_map.h"
+#include "s21_concurrent_set.h"
+#include "s21_concurrent_skip_map.h"
+#include "s21_concurrent_stack.h"
+#include "s21_counted_multiset.h"
+#include "s21_frozen_set.h"
+#include "s21_indexed_priority_queue.h"
+#include "s21_intrusive_list.h"
+#include "s21_mpmc_queue.h"
 #include "s21_multiset.h"
+#include "s21_parallel_set_algebra.h"
+#include "s21_persistent_map.h"
+#include "s21_priority_queue.h"
+#include "s21_sharded_map.h"
+#include "s21_spsc_queue.h"
+#include "s21_unrolled_list.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
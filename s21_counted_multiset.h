@@ -0,0 +1,197 @@
+#ifndef SRC_S21_COUNTED_MULTISET_H_
+#define SRC_S21_COUNTED_MULTISET_H_
+
+#include <functional>
+#include <utility>
+
+#include "RBTree.h"
+
+namespace s21 {
+template <class T>
+class counted_multiset {
+ public:
+    using key_type = T;
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+ private:
+    using _node_value = std::pair<const key_type, size_type>;
+
+    struct cmp_pair_by_key {
+        bool operator()(_node_value const &a, _node_value const &b) const {
+            return a.first < b.first;
+        }
+    };
+
+    using _tree = RBTree<_node_value, cmp_pair_by_key>;
+
+    template <typename _Tree_it>
+    struct _Counted_iterator {
+        using _Self = _Counted_iterator;
+
+        _Tree_it _it;
+        size_type _rep;
+
+        _Counted_iterator(_Tree_it it, size_type rep) noexcept : _it(it), _rep(rep) {}
+
+        operator _Counted_iterator<typename _tree::const_iterator>() const {
+            return _Counted_iterator<typename _tree::const_iterator>(_it, _rep);
+        }
+
+        const_reference operator*() const noexcept { return (*_it).first; }
+
+        _Self &operator++() noexcept {
+            if (_rep + 1 < (*_it).second) {
+                ++_rep;
+            } else {
+                ++_it;
+                _rep = 0;
+            }
+            return *this;
+        }
+
+        _Self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _Self &operator--() noexcept {
+            if (_rep > 0) {
+                --_rep;
+            } else {
+                --_it;
+                _rep = (*_it).second - 1;
+            }
+            return *this;
+        }
+
+        _Self operator--(int) noexcept {
+            auto it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_Self const &other) const noexcept {
+            return _it == other._it && _rep == other._rep;
+        }
+
+        bool operator!=(_Self const &other) const noexcept {
+            return !(*this == other);
+        }
+    };
+
+ public:
+    using iterator = _Counted_iterator<typename _tree::iterator>;
+    using const_iterator = _Counted_iterator<typename _tree::const_iterator>;
+
+    counted_multiset() : _size(0) {}
+    explicit counted_multiset(std::initializer_list<value_type> const &items)
+        : _size(0) {
+        for (auto it = items.begin(); it != items.end(); ++it) {
+            insert(*it);
+        }
+    }
+    counted_multiset(const counted_multiset &m) : data(_tree(m.data)), _size(m._size) {}
+    counted_multiset(counted_multiset &&m) : _size(0) {
+        std::swap(data, m.data);
+        std::swap(_size, m._size);
+    }
+    ~counted_multiset() {}
+    counted_multiset &operator=(counted_multiset &&m) {
+        std::swap(data, m.data);
+        std::swap(_size, m._size);
+        return *this;
+    }
+
+    iterator begin() noexcept { return iterator(data.begin(), 0); }
+    iterator end() noexcept { return iterator(data.end(), 0); }
+    const_iterator begin() const noexcept { return const_iterator(data.begin(), 0); }
+    const_iterator end() const noexcept { return const_iterator(data.end(), 0); }
+
+    bool empty() const noexcept { return data.empty(); }
+    size_type size() const noexcept { return _size; }
+    size_type distinct_size() const noexcept { return data.size(); }
+    size_type max_size() const noexcept { return data.max_size(); }
+    /*  the per-key counts are metadata  */
+    memory_footprint memory_usage() const {
+        memory_footprint usage = data.memory_usage();
+        size_type counts = data.size() * (sizeof(_node_value) - sizeof(key_type));
+        usage.payload -= counts;
+        usage.metadata += counts + sizeof(*this) - sizeof(_tree);
+        return usage;
+    }
+
+    void clear() {
+        data.clear();
+        _size = 0;
+    }
+    std::pair<iterator, bool> insert(const value_type &value) {
+        auto it = data.find(_probe(value));
+        if (it == data.end()) {
+            it = data.insert(_node_value(value, 1)).first;
+        } else {
+            ++(*it).second;
+        }
+        ++_size;
+        return std::make_pair(iterator(it, (*it).second - 1), true);
+    }
+    void erase(iterator pos) {
+        if ((*pos._it).second > 1) {
+            --(*pos._it).second;
+        } else {
+            data.erase(pos._it);
+        }
+        --_size;
+    }
+    void swap(counted_multiset &other) {
+        data.swap(other.data);
+        std::swap(_size, other._size);
+    }
+    void merge(counted_multiset &other) {
+        for (auto it = other.data.begin(); it != other.data.end(); ++it) {
+            auto found = data.find(*it);
+            if (found == data.end()) {
+                data.insert(*it);
+            } else {
+                (*found).second += (*it).second;
+            }
+            _size += (*it).second;
+        }
+    }
+
+    iterator find(const key_type &key) { return iterator(data.find(_probe(key)), 0); }
+    bool contains(const key_type &key) { return data.contains(_probe(key)); }
+    size_type count(const key_type &key) {
+        auto it = data.find(_probe(key));
+        return (it == data.end()) ? 0 : (*it).second;
+    }
+    std::pair<iterator, iterator> equal_range(const key_type &key) {
+        auto it = data.find(_probe(key));
+        auto next = it;
+        if (it != data.end()) {
+            ++next;
+        }
+        return std::make_pair(iterator(it, 0), iterator(next, 0));
+    }
+    iterator lower_bound(const key_type &key) { return iterator(data.lower_bound(_probe(key)), 0); }
+    iterator upper_bound(const key_type &key) { return iterator(data.upper_bound(_probe(key)), 0); }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args) {
+        std::pair<iterator, bool> res(begin(), false);
+        ([&]() { res = insert(args); }(), ...);
+        return res;
+    }
+
+ private:
+    _tree data;
+    size_type _size;
+
+    static _node_value _probe(const key_type &key) { return _node_value(key, 0); }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_COUNTED_MULTISET_H_
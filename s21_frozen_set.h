@@ -0,0 +1,335 @@
+#ifndef SRC_S21_FROZEN_SET_H_
+#define SRC_S21_FROZEN_SET_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace s21 {
+template <class T>
+class set;
+
+template <typename T>
+class frozen_set {
+ private:
+    struct _Frozen_set_iterator;
+
+ public:
+    using key_type = T;
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using iterator = _Frozen_set_iterator;
+    using const_iterator = _Frozen_set_iterator;
+    using size_type = std::size_t;
+
+    frozen_set();
+    template <typename ForwardIt>
+    frozen_set(ForwardIt first, ForwardIt last);
+    explicit frozen_set(std::initializer_list<value_type> const &items);
+    frozen_set(frozen_set const &s);
+    frozen_set(frozen_set &&s);
+    ~frozen_set();
+
+    frozen_set &operator=(frozen_set &&s);
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+
+    void swap(frozen_set &other);
+
+    const_iterator find(const key_type &key) const noexcept;
+    bool contains(const key_type &key) const noexcept;
+    size_type count(const key_type &key) const noexcept;
+    const_iterator lower_bound(const key_type &key) const noexcept;
+
+    memory_footprint memory_usage() const;
+
+ private:
+    /*  keys are stored in Eytzinger (BFS) order, _head[1] is the root and
+     * _head[k] has children _head[2k] and _head[2k + 1], _head[0] is unused.
+     * layout and search described here: https://algorithmica.org/en/eytzinger */
+    size_type _size;
+    T *_head;
+
+    static size_type const _cache_line = 64;
+    static size_type const _prefetch_stride = (sizeof(T) < _cache_line) ? _cache_line / sizeof(T) : 1;
+
+    std::allocator<T> _a;
+    using _Frozen_set_manager = std::allocator_traits<std::allocator<T>>;
+
+    /*  set::freeze() hands over keys that are already sorted and unique  */
+    struct _Sorted_unique {};
+    template <typename InputIt>
+    frozen_set(_Sorted_unique, InputIt first, InputIt last);
+    friend class set<T>;
+
+    template <typename InputIt>
+    InputIt _build(InputIt it, size_type k);
+    size_type _lower_bound(const key_type &key) const noexcept;
+
+    struct _Frozen_set_iterator {
+        using _Self = _Frozen_set_iterator;
+
+        T const *_head;
+        size_type _size;
+        size_type _k;
+
+        _Frozen_set_iterator(T const *head, size_type size, size_type k) noexcept
+            : _head(head), _size(size), _k(k) {
+        }
+
+        const_reference operator*() const noexcept {
+            return _head[_k];
+        }
+
+        _Self &operator++() noexcept {
+            if (2 * _k + 1 <= _size) {
+                _k = 2 * _k + 1;
+                while (2 * _k <= _size) {
+                    _k = 2 * _k;
+                }
+            } else {
+                while (_k & 1) {
+                    _k >>= 1;
+                }
+                _k >>= 1;
+            }
+            return *this;
+        }
+
+        _Self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _Self &operator--() noexcept {
+            if (_k == 0) {
+                _k = (_size > 0) ? 1 : 0;
+                while (_k != 0 && 2 * _k + 1 <= _size) {
+                    _k = 2 * _k + 1;
+                }
+            } else if (2 * _k <= _size) {
+                _k = 2 * _k;
+                while (2 * _k + 1 <= _size) {
+                    _k = 2 * _k + 1;
+                }
+            } else {
+                while (_k != 0 && (_k & 1) == 0) {
+                    _k >>= 1;
+                }
+                _k >>= 1;
+            }
+            return *this;
+        }
+
+        _Self operator--(int) noexcept {
+            auto it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_Self const &other) const noexcept {
+            return _head == other._head && _k == other._k;
+        }
+
+        bool operator!=(_Self const &other) const noexcept {
+            return !(*this == other);
+        }
+    };
+};
+
+template <typename T>
+frozen_set<T>::frozen_set() : _size(0), _head(_Frozen_set_manager::allocate(_a, 1)) {
+    S21_TRACK_ALLOCATED("frozen_set", sizeof(T));
+}
+
+template <typename T>
+template <typename ForwardIt>
+frozen_set<T>::frozen_set(ForwardIt first, ForwardIt last) : _size(0), _head(nullptr) {
+    /*  the range is measured before it is copied, so it has to be multi-pass  */
+    static_assert(std::is_base_of<std::forward_iterator_tag,
+                                  typename std::iterator_traits<ForwardIt>::iterator_category>::value,
+                  "frozen_set needs a forward iterator range");
+    size_type count = static_cast<size_type>(std::distance(first, last));
+    T *sorted = _Frozen_set_manager::allocate(_a, count);
+    S21_TRACK_ALLOCATED("frozen_set", count * sizeof(T));
+    std::uninitialized_copy(first, last, sorted);
+    std::sort(sorted, sorted + count);
+    T *unique_end = std::unique(sorted, sorted + count,
+                                [](const_reference a, const_reference b) { return !(a < b) && !(b < a); });
+
+    _size = static_cast<size_type>(unique_end - sorted);
+    _head = _Frozen_set_manager::allocate(_a, _size + 1);
+    S21_TRACK_ALLOCATED("frozen_set", (_size + 1) * sizeof(T));
+    _build(static_cast<T const *>(sorted), 1);
+
+    for (size_type i = 0; i < count; ++i) {
+        _Frozen_set_manager::destroy(_a, sorted + i);
+    }
+    _Frozen_set_manager::deallocate(_a, sorted, count);
+    S21_TRACK_RELEASED("frozen_set", count * sizeof(T));
+}
+
+template <typename T>
+frozen_set<T>::frozen_set(std::initializer_list<value_type> const &items)
+    : frozen_set(items.begin(), items.end()) {
+}
+
+template <typename T>
+template <typename InputIt>
+frozen_set<T>::frozen_set(_Sorted_unique, InputIt first, InputIt last) : _size(0), _head(nullptr) {
+    for (auto it = first; it != last; ++it) {
+        ++_size;
+    }
+    _head = _Frozen_set_manager::allocate(_a, _size + 1);
+    S21_TRACK_ALLOCATED("frozen_set", (_size + 1) * sizeof(T));
+    _build(first, 1);
+}
+
+template <typename T>
+frozen_set<T>::frozen_set(frozen_set const &s)
+    : _size(s._size), _head(_Frozen_set_manager::allocate(_a, s._size + 1)) {
+    S21_TRACK_ALLOCATED("frozen_set", (_size + 1) * sizeof(T));
+    std::uninitialized_copy(s._head + 1, s._head + _size + 1, _head + 1);
+}
+
+template <typename T>
+frozen_set<T>::frozen_set(frozen_set &&s) : frozen_set() {
+    swap(s);
+}
+
+template <typename T>
+frozen_set<T>::~frozen_set() {
+    for (size_type k = 1; k <= _size; ++k) {
+        _Frozen_set_manager::destroy(_a, _head + k);
+    }
+    _Frozen_set_manager::deallocate(_a, _head, _size + 1);
+    S21_TRACK_RELEASED("frozen_set", (_size + 1) * sizeof(T));
+}
+
+template <typename T>
+frozen_set<T> &frozen_set<T>::operator=(frozen_set &&s) {
+    if (this != &s) {
+        frozen_set(std::move(s)).swap(*this);
+    }
+    return *this;
+}
+
+template <typename T>
+template <typename InputIt>
+InputIt frozen_set<T>::_build(InputIt it, size_type k) {
+    if (k <= _size) {
+        it = _build(it, 2 * k);
+        _Frozen_set_manager::construct(_a, _head + k, *it);
+        ++it;
+        it = _build(it, 2 * k + 1);
+    }
+    return it;
+}
+
+template <typename T>
+typename frozen_set<T>::size_type frozen_set<T>::_lower_bound(const key_type &key) const noexcept {
+    size_type k = 1;
+    while (k <= _size) {
+        /*  descendants of k four levels down share one cache line, so the line is
+         * requested while the next levels are still being compared  */
+#if defined(__GNUC__)
+        __builtin_prefetch(reinterpret_cast<void const *>(reinterpret_cast<std::uintptr_t>(_head) +
+                                                          k * _prefetch_stride * sizeof(T)));
+#endif
+        k = 2 * k + static_cast<size_type>(_head[k] < key);
+    }
+    /*  drop the trailing right turns and the last left turn  */
+#if defined(__GNUC__)
+    k >>= __builtin_ffsll(static_cast<long long>(~k));
+#else
+    while (k & 1) {
+        k >>= 1;
+    }
+    k >>= 1;
+#endif
+    return k;
+}
+
+template <typename T>
+typename frozen_set<T>::const_iterator frozen_set<T>::begin() const noexcept {
+    size_type k = (_size > 0) ? 1 : 0;
+    while (k != 0 && 2 * k <= _size) {
+        k = 2 * k;
+    }
+    return _Frozen_set_iterator(_head, _size, k);
+}
+
+template <typename T>
+typename frozen_set<T>::const_iterator frozen_set<T>::end() const noexcept {
+    return _Frozen_set_iterator(_head, _size, 0);
+}
+
+template <typename T>
+bool frozen_set<T>::empty() const noexcept {
+    return _size == 0;
+}
+
+template <typename T>
+typename frozen_set<T>::size_type frozen_set<T>::size() const noexcept {
+    return _size;
+}
+
+template <typename T>
+typename frozen_set<T>::size_type frozen_set<T>::max_size() const noexcept {
+    return _Frozen_set_manager::max_size(_a) - 1;
+}
+
+template <typename T>
+void frozen_set<T>::swap(frozen_set &other) {
+    std::swap(_size, other._size);
+    std::swap(_head, other._head);
+}
+
+template <typename T>
+typename frozen_set<T>::const_iterator frozen_set<T>::find(const key_type &key) const noexcept {
+    size_type k = _lower_bound(key);
+    if (k != 0 && key < _head[k]) {
+        k = 0;
+    }
+    return _Frozen_set_iterator(_head, _size, k);
+}
+
+template <typename T>
+bool frozen_set<T>::contains(const key_type &key) const noexcept {
+    size_type k = _lower_bound(key);
+    return k != 0 && !(key < _head[k]);
+}
+
+template <typename T>
+typename frozen_set<T>::size_type frozen_set<T>::count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+}
+
+template <typename T>
+typename frozen_set<T>::const_iterator frozen_set<T>::lower_bound(const key_type &key) const noexcept {
+    return _Frozen_set_iterator(_head, _size, _lower_bound(key));
+}
+
+template <typename T>
+memory_footprint frozen_set<T>::memory_usage() const {
+    /*  _head[0] is never used  */
+    memory_footprint usage = buffer_footprint(_size, _size + 1, sizeof(T));
+    usage.metadata += sizeof(*this);
+    return usage;
+}
+}  // namespace s21
+
+#endif  // SRC_S21_FROZEN_SET_H_
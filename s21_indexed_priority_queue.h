@@ -0,0 +1,274 @@
+#ifndef SRC_S21_INDEXED_PRIORITY_QUEUE_H_
+#define SRC_S21_INDEXED_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+/*  d-ary min-heap of (id, key) pairs for dense integer ids, as used by
+ * Dijkstra and A*. every id is in the heap at most once, a flat position
+ * map from id to heap slot lets decrease_key(), erase() and contains()
+ * find it without a search. keys are stored next to their ids in the heap
+ * so sifting compares within the heap array only. top() is the entry with
+ * the smallest key according to Compare  */
+template <class Key, class Compare = std::less<Key>, std::size_t Arity = 4>
+struct indexed_priority_queue {
+    using key_type = Key;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using id_type = std::size_t;
+    using value_type = std::pair<id_type, key_type>;
+    using const_reference = value_type const &;
+
+    static_assert(Arity >= 2, "indexed_priority_queue needs an arity of at least 2");
+
+    indexed_priority_queue();
+    explicit indexed_priority_queue(size_type id_count, Compare const &compare = Compare());
+    indexed_priority_queue(indexed_priority_queue const &q);
+    indexed_priority_queue(indexed_priority_queue &&q);
+    ~indexed_priority_queue();
+
+    indexed_priority_queue &operator=(indexed_priority_queue &&q);
+
+    const_reference top() const;
+    key_type const &key(id_type id) const;
+
+    bool empty() const;
+    size_type size() const;
+    bool contains(id_type id) const;
+    /*  the position map is metadata  */
+    memory_footprint memory_usage() const;
+
+    void push(id_type id, key_type const &key);
+    void pop();
+    void decrease_key(id_type id, key_type const &key);
+    /*  moves the entry either way, for keys that may grow as well  */
+    void update(id_type id, key_type const &key);
+    size_type erase(id_type id);
+    void clear();
+    void swap(indexed_priority_queue &q);
+
+ private:
+    static constexpr size_type _npos = ~size_type(0);
+
+    vector<value_type> _heap;
+    vector<size_type> _pos;
+    Compare _comp;
+
+    size_type _slot(id_type id) const;
+    void _place(size_type i, value_type &&entry);
+    void _sift_up(size_type i);
+    void _sift_down(size_type i);
+};
+
+template <typename Key, typename Compare, std::size_t Arity>
+indexed_priority_queue<Key, Compare, Arity>::indexed_priority_queue() : _heap(), _pos(), _comp() {
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+indexed_priority_queue<Key, Compare, Arity>::indexed_priority_queue(size_type id_count,
+                                                                    Compare const &compare)
+    : _heap(), _pos(), _comp(compare) {
+    _heap.reserve(id_count);
+    _pos.reserve(id_count);
+    for (size_type i = 0; i < id_count; ++i) {
+        _pos.push_back(_npos);
+    }
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+indexed_priority_queue<Key, Compare, Arity>::indexed_priority_queue(indexed_priority_queue const &q)
+    : _heap(q._heap), _pos(q._pos), _comp(q._comp) {
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+indexed_priority_queue<Key, Compare, Arity>::indexed_priority_queue(indexed_priority_queue &&q)
+    : _heap(std::move(q._heap)), _pos(std::move(q._pos)), _comp(std::move(q._comp)) {
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+indexed_priority_queue<Key, Compare, Arity>::~indexed_priority_queue() {
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+indexed_priority_queue<Key, Compare, Arity> &indexed_priority_queue<Key, Compare, Arity>::operator=(
+    indexed_priority_queue &&q) {
+    if (this != &q) {
+        indexed_priority_queue(std::move(q)).swap(*this);
+    }
+    return *this;
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<Key, Compare, Arity>::const_reference
+indexed_priority_queue<Key, Compare, Arity>::top() const {
+    return _heap.front();
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<Key, Compare, Arity>::key_type const &
+indexed_priority_queue<Key, Compare, Arity>::key(id_type id) const {
+    return _heap[_slot(id)].second;
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+bool indexed_priority_queue<Key, Compare, Arity>::empty() const {
+    return _heap.empty();
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<Key, Compare, Arity>::size_type
+indexed_priority_queue<Key, Compare, Arity>::size() const {
+    return _heap.size();
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+bool indexed_priority_queue<Key, Compare, Arity>::contains(id_type id) const {
+    return id < _pos.size() && _pos[id] != _npos;
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+memory_footprint indexed_priority_queue<Key, Compare, Arity>::memory_usage() const {
+    memory_footprint usage = _heap.memory_usage();
+    memory_footprint positions = _pos.memory_usage();
+    positions.metadata += positions.payload;
+    positions.payload = 0;
+    usage += positions;
+    usage.metadata += sizeof(*this) - sizeof(_heap) - sizeof(_pos);
+    return usage;
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::push(id_type id, key_type const &key) {
+    if (contains(id)) {
+        throw std::invalid_argument("indexed_priority_queue::push: id is already queued");
+    }
+    while (_pos.size() <= id) {
+        _pos.push_back(_npos);
+    }
+    _pos[id] = _heap.size();
+    _heap.push_back(value_type(id, key));
+    _sift_up(_heap.size() - 1);
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::pop() {
+    erase(_heap.front().first);
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::decrease_key(id_type id, key_type const &key) {
+    size_type i = _slot(id);
+    if (_comp(_heap[i].second, key)) {
+        throw std::invalid_argument("indexed_priority_queue::decrease_key: key would increase");
+    }
+    _heap[i].second = key;
+    _sift_up(i);
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::update(id_type id, key_type const &key) {
+    size_type i = _slot(id);
+    bool increased = _comp(_heap[i].second, key);
+    _heap[i].second = key;
+    if (increased) {
+        _sift_down(i);
+    } else {
+        _sift_up(i);
+    }
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<Key, Compare, Arity>::size_type
+indexed_priority_queue<Key, Compare, Arity>::erase(id_type id) {
+    if (!contains(id)) {
+        return 0;
+    }
+    size_type i = _pos[id];
+    size_type last = _heap.size() - 1;
+    _pos[id] = _npos;
+    if (i != last) {
+        bool increased = _comp(_heap[i].second, _heap[last].second);
+        _place(i, std::move(_heap[last]));
+        _heap.pop_back();
+        if (increased) {
+            _sift_down(i);
+        } else {
+            _sift_up(i);
+        }
+    } else {
+        _heap.pop_back();
+    }
+    return 1;
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::clear() {
+    for (size_type i = 0; i < _heap.size(); ++i) {
+        _pos[_heap[i].first] = _npos;
+    }
+    _heap.clear();
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::swap(indexed_priority_queue &q) {
+    _heap.swap(q._heap);
+    _pos.swap(q._pos);
+    std::swap(_comp, q._comp);
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<Key, Compare, Arity>::size_type
+indexed_priority_queue<Key, Compare, Arity>::_slot(id_type id) const {
+    if (!contains(id)) {
+        throw std::out_of_range("indexed_priority_queue: id is not queued");
+    }
+    return _pos[id];
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::_place(size_type i, value_type &&entry) {
+    _pos[entry.first] = i;
+    _heap[i] = std::move(entry);
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::_sift_up(size_type i) {
+    value_type entry = std::move(_heap[i]);
+    while (i > 0) {
+        size_type parent = (i - 1) / Arity;
+        if (!_comp(entry.second, _heap[parent].second)) {
+            break;
+        }
+        _place(i, std::move(_heap[parent]));
+        i = parent;
+    }
+    _place(i, std::move(entry));
+}
+
+template <typename Key, typename Compare, std::size_t Arity>
+void indexed_priority_queue<Key, Compare, Arity>::_sift_down(size_type i) {
+    size_type n = _heap.size();
+    value_type entry = std::move(_heap[i]);
+    for (size_type first = Arity * i + 1; first < n; first = Arity * i + 1) {
+        size_type last = (n - first < Arity) ? n : first + Arity;
+        size_type best = first;
+        for (size_type child = first + 1; child < last; ++child) {
+            if (_comp(_heap[child].second, _heap[best].second)) {
+                best = child;
+            }
+        }
+        if (!_comp(_heap[best].second, entry.second)) {
+            break;
+        }
+        _place(i, std::move(_heap[best]));
+        i = best;
+    }
+    _place(i, std::move(entry));
+}
+}  // namespace s21
+
+#endif  // SRC_S21_INDEXED_PRIORITY_QUEUE_H_
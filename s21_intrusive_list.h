@@ -0,0 +1,436 @@
+#ifndef SRC_S21_INTRUSIVE_LIST_H_
+#define SRC_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  the links an object needs to sit on one intrusive_list, an object that
+ * sits on several lists at once has one hook per list. copying an object
+ * copies none of its memberships  */
+struct intrusive_list_hook {
+    intrusive_list_hook *_prev;
+    intrusive_list_hook *_next;
+
+    intrusive_list_hook() noexcept : _prev(nullptr), _next(nullptr) {
+    }
+
+    intrusive_list_hook(intrusive_list_hook const &) noexcept : intrusive_list_hook() {
+    }
+
+    intrusive_list_hook &operator=(intrusive_list_hook const &) noexcept {
+        return *this;
+    }
+
+    bool is_linked() const noexcept {
+        return _next != nullptr;
+    }
+};
+
+/*  a list of objects it does not own, linked through their Hook member, so
+ * adding and removing never allocate or copy. the circular sentinel of
+ * s21::list lives inside the list object instead of on the heap, moving
+ * or swapping a list repoints its first and last element. an object has
+ * to be taken off a list (erase, pop, clear) before it is destroyed.
+ * T has to be standard-layout, so that Hook sits at the same offset in
+ * every T and a hook can be turned back into its object  */
+template <typename T, intrusive_list_hook T::*Hook>
+struct intrusive_list {
+ private:
+    struct _Intrusive_iterator;
+    struct _Intrusive_const_iterator;
+
+ public:
+    static_assert(std::is_standard_layout<T>::value, "intrusive_list needs a standard-layout T");
+
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using iterator = _Intrusive_iterator;
+    using const_iterator = _Intrusive_const_iterator;
+    using size_type = std::size_t;
+
+    intrusive_list() noexcept;
+    intrusive_list(intrusive_list const &) = delete;
+    intrusive_list(intrusive_list &&l) noexcept;
+    ~intrusive_list();
+
+    intrusive_list &operator=(intrusive_list const &) = delete;
+    intrusive_list &operator=(intrusive_list &&l) noexcept;
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    void clear() noexcept;
+    iterator insert(const_iterator pos, reference value) noexcept;
+    iterator erase(const_iterator pos) noexcept;
+    void erase(reference value) noexcept;
+    void push_back(reference value) noexcept;
+    void pop_back() noexcept;
+    void push_front(reference value) noexcept;
+    void pop_front() noexcept;
+    void swap(intrusive_list &other) noexcept;
+    void splice(const_iterator pos, intrusive_list &other) noexcept;
+
+    iterator iterator_to(reference value) noexcept;
+    const_iterator iterator_to(const_reference value) const noexcept;
+
+    memory_footprint memory_usage() const;
+
+ private:
+    size_type _size;
+    intrusive_list_hook _head;
+
+    static T *_owner(intrusive_list_hook *hook) noexcept;
+    static T const *_owner(intrusive_list_hook const *hook) noexcept;
+    static std::ptrdiff_t _hook_offset() noexcept;
+    static void _link(intrusive_list_hook *pos, intrusive_list_hook *hook) noexcept;
+    static void _unlink(intrusive_list_hook *hook) noexcept;
+    void _adopt(intrusive_list &l) noexcept;
+
+    struct _Intrusive_iterator {
+        using _Self = _Intrusive_iterator;
+
+        intrusive_list_hook *_hook;
+
+        explicit _Intrusive_iterator(intrusive_list_hook *hook) noexcept : _hook(hook) {
+        }
+
+        operator _Intrusive_const_iterator() const {
+            return _Intrusive_const_iterator(_hook);
+        }
+
+        reference operator*() const noexcept {
+            return *_owner(_hook);
+        }
+
+        _Self &operator++() noexcept {
+            _hook = _hook->_next;
+            return *this;
+        }
+
+        _Self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _Self &operator--() noexcept {
+            _hook = _hook->_prev;
+            return *this;
+        }
+
+        _Self operator--(int) noexcept {
+            auto it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_Self const &other) const noexcept {
+            return _hook == other._hook;
+        }
+
+        bool operator!=(_Self const &other) const noexcept {
+            return _hook != other._hook;
+        }
+    };
+
+    struct _Intrusive_const_iterator {
+        using _Self = _Intrusive_const_iterator;
+
+        intrusive_list_hook const *_hook;
+
+        explicit _Intrusive_const_iterator(intrusive_list_hook const *hook) noexcept : _hook(hook) {
+        }
+
+        _Intrusive_iterator _const_cast() const noexcept {
+            return _Intrusive_iterator(const_cast<intrusive_list_hook *>(_hook));
+        }
+
+        const_reference operator*() const noexcept {
+            return *_owner(_hook);
+        }
+
+        _Self &operator++() noexcept {
+            _hook = _hook->_next;
+            return *this;
+        }
+
+        _Self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _Self &operator--() noexcept {
+            _hook = _hook->_prev;
+            return *this;
+        }
+
+        _Self operator--(int) noexcept {
+            auto it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_Self const &other) const noexcept {
+            return _hook == other._hook;
+        }
+
+        bool operator!=(_Self const &other) const noexcept {
+            return _hook != other._hook;
+        }
+    };
+};
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() noexcept : _size(0) {
+    _head._prev = &_head;
+    _head._next = &_head;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list &&l) noexcept : intrusive_list() {
+    _adopt(l);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+    clear();
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(intrusive_list &&l) noexcept {
+    if (this != &l) {
+        clear();
+        _adopt(l);
+    }
+    return *this;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::front() {
+    return *_owner(_head._next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_reference intrusive_list<T, Hook>::front() const {
+    return *_owner(_head._next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::back() {
+    return *_owner(_head._prev);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_reference intrusive_list<T, Hook>::back() const {
+    return *_owner(_head._prev);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::begin() noexcept {
+    return _Intrusive_iterator(_head._next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::begin() const noexcept {
+    return _Intrusive_const_iterator(_head._next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::end() noexcept {
+    return _Intrusive_iterator(&_head);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::end() const noexcept {
+    return _Intrusive_const_iterator(&_head);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const noexcept {
+    return _head._next == &_head;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size() const noexcept {
+    return _size;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() noexcept {
+    intrusive_list_hook *hook = _head._next;
+    while (hook != &_head) {
+        intrusive_list_hook *next = hook->_next;
+        hook->_prev = hook->_next = nullptr;
+        hook = next;
+    }
+    _head._prev = _head._next = &_head;
+    _size = 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const_iterator pos,
+                                                                           reference value) noexcept {
+    intrusive_list_hook *hook = &(value.*Hook);
+    _link(pos._const_cast()._hook, hook);
+    ++_size;
+    return _Intrusive_iterator(hook);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator pos) noexcept {
+    intrusive_list_hook *hook = pos._const_cast()._hook;
+    intrusive_list_hook *next = hook->_next;
+    _unlink(hook);
+    --_size;
+    return _Intrusive_iterator(next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(reference value) noexcept {
+    erase(iterator_to(value));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(reference value) noexcept {
+    insert(end(), value);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() noexcept {
+    if (!empty()) {
+        erase(--end());
+    }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(reference value) noexcept {
+    insert(begin(), value);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() noexcept {
+    if (!empty()) {
+        erase(begin());
+    }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) noexcept {
+    if (this != &other) {
+        intrusive_list tmp(std::move(other));
+        other._adopt(*this);
+        _adopt(tmp);
+    }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other) noexcept {
+    if (this != &other && !other.empty()) {
+        intrusive_list_hook *next = pos._const_cast()._hook;
+        intrusive_list_hook *prev = next->_prev;
+        prev->_next = other._head._next;
+        other._head._next->_prev = prev;
+        next->_prev = other._head._prev;
+        other._head._prev->_next = next;
+        _size += other._size;
+        other._head._prev = other._head._next = &other._head;
+        other._size = 0;
+    }
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::iterator_to(reference value) noexcept {
+    return _Intrusive_iterator(&(value.*Hook));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::iterator_to(
+    const_reference value) const noexcept {
+    return _Intrusive_const_iterator(&(value.*Hook));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+memory_footprint intrusive_list<T, Hook>::memory_usage() const {
+    /*  the hooks belong to the elements, which the list does not own  */
+    memory_footprint usage;
+    usage.metadata = sizeof(*this);
+    return usage;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T *intrusive_list<T, Hook>::_owner(intrusive_list_hook *hook) noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<char *>(hook) - _hook_offset());
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T const *intrusive_list<T, Hook>::_owner(intrusive_list_hook const *hook) noexcept {
+    return reinterpret_cast<T const *>(reinterpret_cast<char const *>(hook) - _hook_offset());
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+std::ptrdiff_t intrusive_list<T, Hook>::_hook_offset() noexcept {
+    /*  offsetof takes a member name, not a member pointer, so the offset of
+     * Hook is read off a union member that is never constructed: only the
+     * addresses of the T and of its hook are taken. a standard-layout T has
+     * no virtual bases, so the offset is the same in every T, and the
+     * compiler folds the whole call to a constant  */
+    union _Probe {
+        char none;
+        T object;
+
+        _Probe() noexcept : none() {
+        }
+
+        ~_Probe() {
+        }
+    } probe;
+    return reinterpret_cast<char *>(&(probe.object.*Hook)) - reinterpret_cast<char *>(&probe.object);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::_link(intrusive_list_hook *pos, intrusive_list_hook *hook) noexcept {
+    hook->_prev = pos->_prev;
+    hook->_next = pos;
+    pos->_prev->_next = hook;
+    pos->_prev = hook;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::_unlink(intrusive_list_hook *hook) noexcept {
+    hook->_prev->_next = hook->_next;
+    hook->_next->_prev = hook->_prev;
+    hook->_prev = hook->_next = nullptr;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::_adopt(intrusive_list &l) noexcept {
+    /*  takes over the elements of l into this empty list  */
+    if (!l.empty()) {
+        _head._next = l._head._next;
+        _head._prev = l._head._prev;
+        _head._next->_prev = &_head;
+        _head._prev->_next = &_head;
+        _size = l._size;
+        l._head._prev = l._head._next = &l._head;
+        l._size = 0;
+    }
+}
+}  // namespace s21
+
+#endif  // SRC_S21_INTRUSIVE_LIST_H_
@@ -1,9 +1,13 @@
 #ifndef SRC_S21_LIST_H_
 #define SRC_S21_LIST_H_
 
+#include <functional>
 #include <memory>
 #include <utility>
 
+#include "ContainerStats.h"
+#include "MemoryUsage.h"
+
 namespace s21 {
 template <typename T>
 struct list {
@@ -59,19 +63,51 @@ struct list {
     void swap(list &other);
 
     void merge(list &other);
+    template <typename Compare>
+    void merge(list &other, Compare comp);
     void splice(const_iterator pos, list &other);
+    void splice(const_iterator pos, list &other, const_iterator it);
+    void splice(const_iterator pos, list &other, const_iterator first, const_iterator last);
+    void splice(const_iterator pos, list &other, const_iterator first, const_iterator last,
+                size_type count);
     void reverse() noexcept;
     void unique();
+    template <typename BinaryPredicate>
+    void unique(BinaryPredicate pred);
     void sort();
+    template <typename Compare>
+    void sort(Compare comp);
+
+    size_type cache_limit() const noexcept;
+    void set_cache_limit(size_type limit);
+    size_type cached_nodes() const noexcept;
+    void shrink_to_fit();
+
+    container_stats stats() const;
+    memory_footprint memory_usage() const;
 
  private:
     size_type _size;
     _List_node *_head;
 
+    /*  erased nodes are kept for the next insertions, up to _cache_limit of
+     * them, chained through _next, so a list used as a queue stops calling
+     * malloc and free once it reaches its steady length  */
+    _List_node *_cache;
+    size_type _cached;
+    size_type _cache_limit;
+
+    static size_type const _default_cache_limit = 64;
+
+    S21_STATS_COUNTERS
+
     std::allocator<_List_node> _a;
     using _List_node_manager = std::allocator_traits<std::allocator<_List_node>>;
 
     void insert(iterator _pos, _List_node *_node = nullptr) noexcept;
+    static void _relink(_List_node *pos, _List_node *first, _List_node *last) noexcept;
+    _List_node *_acquire_node();
+    void _release_node(_List_node *node);
 
     struct _List_node {
         _List_node *_prev;
@@ -184,65 +220,64 @@ struct list {
         }
     };
 
+    /*  bottom-up merge sort over the nodes chained through _next, bin k
+     * holds a sorted run of 2^k nodes, so the sort takes no memory beyond
+     * the bins and no recursion. runs from older bins go first on ties,
+     * which keeps the sort stable  */
     struct _List_sort {
-        _List_sort() {
-        }
-        ~_List_sort() {
-        }
-
-        static _List_node *_sort(_List_node *_lhs) {
-            if (_lhs == nullptr || _lhs->_next == nullptr) {
-                return _lhs;
+        template <typename Compare>
+        static _List_node *_sort(_List_node *_lhs, Compare &comp) {
+            _List_node *_bins[64] = {};
+            while (_lhs != nullptr) {
+                _List_node *_carry = _lhs;
+                _lhs = _lhs->_next;
+                _carry->_next = nullptr;
+                size_type _k = 0;
+                while (_bins[_k] != nullptr) {
+                    _carry = _merge(_bins[_k], _carry, comp);
+                    _bins[_k++] = nullptr;
+                }
+                _bins[_k] = _carry;
             }
-            _List_node *_rhs = _split(_lhs);
-
-            _lhs = _sort(_lhs);
-            _rhs = _sort(_rhs);
-
-            return _merge(_lhs, _rhs);
-        }
-
-     private:
-        static _List_node *_split(_List_node *_lhs) {
-            _List_node *_f = _lhs;
-            _List_node *_s = _lhs;
-
-            while (_f->_next != nullptr && _f->_next->_next != nullptr) {
-                _f = _f->_next->_next;
-                _s = _s->_next;
+            _List_node *_result = nullptr;
+            for (_List_node *_bin : _bins) {
+                if (_bin != nullptr) {
+                    _result = _merge(_bin, _result, comp);
+                }
             }
-
-            _List_node *_t = _s->_next;
-            _s->_next = nullptr;
-
-            return _t;
+            return _result;
         }
 
-        static _List_node *_merge(_List_node *_lhs, _List_node *_rhs) {
-            if (_lhs == nullptr) {
-                return _rhs;
-            }
-            if (_rhs == nullptr) {
-                return _lhs;
-            }
-
-            if (_lhs->_data < _rhs->_data) {
-                _lhs->_next = _merge(_lhs->_next, _rhs);
-                _lhs->_next->_prev = _lhs;
-                _lhs->_prev = nullptr;
-                return _lhs;
-            } else {
-                _rhs->_next = _merge(_lhs, _rhs->_next);
-                _rhs->_next->_prev = _rhs;
-                _rhs->_prev = nullptr;
-                return _rhs;
+     private:
+        template <typename Compare>
+        static _List_node *_merge(_List_node *_lhs, _List_node *_rhs, Compare &comp) {
+            _List_node *_first = nullptr;
+            _List_node **_tail = &_first;
+            while (_lhs != nullptr && _rhs != nullptr) {
+                if (comp(_rhs->_data, _lhs->_data)) {
+                    *_tail = _rhs;
+                    _rhs = _rhs->_next;
+                } else {
+                    *_tail = _lhs;
+                    _lhs = _lhs->_next;
+                }
+                _tail = &(*_tail)->_next;
             }
+            *_tail = (_lhs != nullptr) ? _lhs : _rhs;
+            return _first;
         }
     };
 };
 
 template <typename T>
-list<T>::list() : _size(0), _head(_List_node_manager::allocate(_a, 1)) {
+list<T>::list()
+    : _size(0),
+      _head(_List_node_manager::allocate(_a, 1)),
+      _cache(nullptr),
+      _cached(0),
+      _cache_limit(_default_cache_limit) {
+    S21_STATS_ADD(allocations, 1);
+    S21_TRACK_ALLOCATED("list", sizeof(_List_node));
     _head->_prev = _head;
     _head->_next = _head;
 }
@@ -250,7 +285,7 @@ list<T>::list() : _size(0), _head(_List_node_manager::allocate(_a, 1)) {
 template <typename T>
 list<T>::list(size_type n) : list() {
     while (n--) {
-        auto node = _List_node_manager::allocate(_a, 1);
+        auto node = _acquire_node();
         _List_node_manager::construct(_a, node);
 
         insert(end(), node);
@@ -279,8 +314,10 @@ list<T>::list(list &&l) : list() {
 template <typename T>
 list<T>::~list() {
     clear();
+    shrink_to_fit();
 
     _List_node_manager::deallocate(_a, _head, 1);
+    S21_TRACK_RELEASED("list", sizeof(_List_node));
 }
 
 template <typename T>
@@ -355,8 +392,9 @@ void list<T>::clear() {
 
 template <typename T>
 typename list<T>::iterator list<T>::insert(iterator pos, const_reference value) {
-    auto node = _List_node_manager::allocate(_a, 1);
+    auto node = _acquire_node();
     _List_node_manager::construct(_a, node, value);
+    S21_STATS_ADD(copies, 1);
 
     insert(pos, node);
 
@@ -387,7 +425,7 @@ template <typename T>
 void list<T>::erase(iterator pos) {
     if (!empty()) {
         _List_node_manager::destroy(_a, pos._node);
-        _List_node_manager::deallocate(_a, pos._node, 1);
+        _release_node(pos._node);
 
         --_size;
     }
@@ -431,49 +469,96 @@ template <typename T>
 void list<T>::swap(list &other) {
     std::swap(_head, other._head);
     std::swap(_size, other._size);
+    std::swap(_cache, other._cache);
+    std::swap(_cached, other._cached);
+    std::swap(_cache_limit, other._cache_limit);
 }
 
 template <typename T>
 void list<T>::merge(list &other) {
-    _List_node *b1 = _head->_next;
-    _List_node *b2 = other._head->_next;
-    while (b2 != other._head) {
-        if (b1 == _head || b2->_data < b1->_data) {
-            _List_node *tmp = b2->_next;
-
-            b2->_prev->_next = b2->_next;
-            b2->_next->_prev = b2->_prev;
-            --other._size;
-
-            insert(_List_iterator(b1), b2);
-
-            b2 = tmp;
-        } else {
-            b1 = b1->_next;
+    merge(other, std::less<value_type>());
+}
+
+template <typename T>
+template <typename Compare>
+void list<T>::merge(list &other, Compare comp) {
+    /*  once this list runs out the rest of other is already in order and
+     * goes to the back in one splice  */
+    if (this != &other) {
+        _List_node *b1 = _head->_next;
+        _List_node *b2 = other._head->_next;
+        while (b1 != _head && b2 != other._head) {
+            if (comp(b2->_data, b1->_data)) {
+                _List_node *next = b2->_next;
+                _relink(b1, b2, b2);
+                ++_size;
+                --other._size;
+                b2 = next;
+            } else {
+                b1 = b1->_next;
+            }
         }
+        splice(end(), other);
     }
 }
 
 template <typename T>
 void list<T>::splice(const_iterator pos, list &other) {
-    _List_iterator position = pos._const_cast();
-
-    _List_node *prev = position._node->_prev;
-    _List_node *curr = position._node;
+    if (this != &other && !other.empty()) {
+        _relink(pos._const_cast()._node, other._head->_next, other._head->_prev);
+        _size += other._size;
+        other._size = 0;
+    }
+}
 
-    _List_node *head = other._head;
+template <typename T>
+void list<T>::splice(const_iterator pos, list &other, const_iterator it) {
+    _List_node *node = it._const_cast()._node;
+    _List_node *next = pos._const_cast()._node;
+    if (node != next && node->_next != next) {
+        _relink(next, node, node);
+        if (this != &other) {
+            ++_size;
+            --other._size;
+        }
+    }
+}
 
-    prev->_next = head->_next;
-    head->_next->_prev = prev;
+template <typename T>
+void list<T>::splice(const_iterator pos, list &other, const_iterator first, const_iterator last) {
+    size_type count = 0;
+    if (this != &other) {
+        for (auto it = first; it != last; ++it) {
+            ++count;
+        }
+    }
+    splice(pos, other, first, last, count);
+}
 
-    prev = head->_prev;
-    head->_prev->_next = curr;
+template <typename T>
+void list<T>::splice(const_iterator pos, list &other, const_iterator first, const_iterator last,
+                     size_type count) {
+    /*  count is the length of [first, last), passing it keeps the splice
+     * O(1) between two lists, within one list it is not needed  */
+    if (first != last) {
+        _relink(pos._const_cast()._node, first._const_cast()._node, last._const_cast()._node->_prev);
+        if (this != &other) {
+            _size += count;
+            other._size -= count;
+        }
+    }
+}
 
-    _size += other._size;
+template <typename T>
+void list<T>::_relink(_List_node *pos, _List_node *first, _List_node *last) noexcept {
+    /*  moves the nodes first..last, both included, in front of pos  */
+    first->_prev->_next = last->_next;
+    last->_next->_prev = first->_prev;
 
-    head->_prev = head;
-    head->_next = head;
-    other._size = 0;
+    first->_prev = pos->_prev;
+    last->_next = pos;
+    pos->_prev->_next = first;
+    pos->_prev = last;
 }
 
 template <typename T>
@@ -492,9 +577,15 @@ void list<T>::reverse() noexcept {
 
 template <typename T>
 void list<T>::unique() {
+    unique(std::equal_to<value_type>());
+}
+
+template <typename T>
+template <typename BinaryPredicate>
+void list<T>::unique(BinaryPredicate pred) {
     _List_node *curr = _head->_next;
     while (curr->_next != _head) {
-        if (curr->_data == curr->_next->_data) {
+        if (pred(curr->_data, curr->_next->_data)) {
             erase(_List_iterator(curr->_next));
         } else {
             curr = curr->_next;
@@ -504,21 +595,97 @@ void list<T>::unique() {
 
 template <typename T>
 void list<T>::sort() {
+    sort(std::less<value_type>());
+}
+
+template <typename T>
+template <typename Compare>
+void list<T>::sort(Compare comp) {
     if (!empty()) {
-        _head->_next->_prev = nullptr;
         _head->_prev->_next = nullptr;
 
-        _head->_next = _List_sort::_sort(_head->_next);
+        _head->_next = _List_sort::_sort(_head->_next, comp);
 
-        _head->_next->_prev = _head;
-        _List_node *node = _head->_next;
-        while (node->_next != nullptr) {
-            node = node->_next;
+        _List_node *prev = _head;
+        for (_List_node *node = _head->_next; node != nullptr; node = node->_next) {
+            node->_prev = prev;
+            prev = node;
         }
-        node->_next = _head;
-        _head->_prev = node;
+        prev->_next = _head;
+        _head->_prev = prev;
+    }
+}
+
+template <typename T>
+typename list<T>::size_type list<T>::cache_limit() const noexcept {
+    return _cache_limit;
+}
+
+template <typename T>
+void list<T>::set_cache_limit(size_type limit) {
+    _cache_limit = limit;
+    while (_cached > _cache_limit) {
+        _List_node *node = _cache;
+        _cache = node->_next;
+        --_cached;
+        _List_node_manager::deallocate(_a, node, 1);
+        S21_TRACK_RELEASED("list", sizeof(_List_node));
     }
 }
+
+template <typename T>
+typename list<T>::size_type list<T>::cached_nodes() const noexcept {
+    return _cached;
+}
+
+template <typename T>
+void list<T>::shrink_to_fit() {
+    size_type limit = _cache_limit;
+    set_cache_limit(0);
+    _cache_limit = limit;
+}
+
+template <typename T>
+typename list<T>::_List_node *list<T>::_acquire_node() {
+    /*  raw memory, the caller constructs the node in it  */
+    _List_node *node = _cache;
+    if (node != nullptr) {
+        _cache = node->_next;
+        --_cached;
+    } else {
+        node = _List_node_manager::allocate(_a, 1);
+        S21_STATS_ADD(allocations, 1);
+        S21_TRACK_ALLOCATED("list", sizeof(_List_node));
+    }
+    return node;
+}
+
+template <typename T>
+void list<T>::_release_node(_List_node *node) {
+    /*  node is already destroyed, only its _next is written  */
+    if (_cached < _cache_limit) {
+        node->_next = _cache;
+        _cache = node;
+        ++_cached;
+    } else {
+        _List_node_manager::deallocate(_a, node, 1);
+        S21_TRACK_RELEASED("list", sizeof(_List_node));
+    }
+}
+
+template <typename T>
+container_stats list<T>::stats() const {
+    return S21_STATS_SNAPSHOT();
+}
+
+template <typename T>
+memory_footprint list<T>::memory_usage() const {
+    memory_footprint usage = node_footprint(_size, sizeof(_List_node), sizeof(T));
+    usage.metadata += sizeof(*this) + sizeof(_List_node);
+    usage.overhead += (_cached + 1) * heap_block_overhead(sizeof(_List_node));
+    usage.slack += _cached * sizeof(_List_node);
+    return usage;
+}
 }  // namespace s21
 
 #endif  // SRC_S21_LIST_H_
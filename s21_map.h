@@ -1,7 +1,9 @@
 #ifndef SRC_S21_MAP_H_
 #define SRC_S21_MAP_H_
 
+#include <algorithm>
 #include <functional>
+#include <new>
 #include <utility>
 
 #include "RBTree.h"
@@ -65,8 +67,21 @@ class map {
         return result;
     }
     void erase(iterator pos) { data.erase(pos); }
+    void erase(iterator first, iterator last) { data.erase(first, last); }
+    size_type erase(const key_type &key) {
+        value_type tmp_pair = std::make_pair(key, mapped_type());
+        return data.erase(tmp_pair);
+    }
     void swap(map &other) { data.swap(other.data); }
     void merge(map &other) { data.merge(other.data); }
+    map split(const key_type &key) {
+        map right;
+        value_type tmp_pair = std::make_pair(key, mapped_type());
+        RBTree<value_type, cmp_pair_by_key> tmp = data.split(tmp_pair);
+        right.data.swap(tmp);
+        return right;
+    }
+    void join(map &other) { data.join(other.data); }
 
     mapped_type &at(const key_type &key) {
         value_type tmp_pair = std::make_pair(key, mapped_type());
@@ -81,15 +96,57 @@ class map {
         value_type tmp_pair = std::make_pair(key, mapped_type());
         return data.contains(tmp_pair);
     }
+    template <size_type Lanes = RBTree<value_type, cmp_pair_by_key>::lookup_lanes>
+    void find_many(const key_type *keys, size_type count, iterator *out) {
+        probe_many(keys, count, [this, out](value_type const *probes, size_type first, size_type n) {
+            data.template find_many<Lanes>(probes, n, out + first);
+        });
+    }
+    template <size_type Lanes = RBTree<value_type, cmp_pair_by_key>::lookup_lanes>
+    void contains_many(const key_type *keys, size_type count, bool *out) {
+        probe_many(keys, count, [this, out](value_type const *probes, size_type first, size_type n) {
+            data.template contains_many<Lanes>(probes, n, out + first);
+        });
+    }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace(Args &&...args) {
         return data.emplace(args...);
     }
 
+    container_stats stats() const { return data.stats(); }
+    memory_footprint memory_usage() const { return data.memory_usage(); }
+
  private:
     RBTree<value_type, cmp_pair_by_key> data;
+
+    /*  the tree compares whole pairs, so the keys are paired with a default
+     * mapped value a slice at a time, in a page of stack storage  */
+    template <typename Lookup>
+    static void probe_many(const key_type *keys, size_type count, Lookup lookup) {
+        static size_type const slice = (sizeof(value_type) < 4096) ? 4096 / sizeof(value_type) : 1;
+        alignas(value_type) unsigned char storage[slice * sizeof(value_type)];
+        value_type *probes = reinterpret_cast<value_type *>(storage);
+        for (size_type first = 0; first < count; first += slice) {
+            size_type n = std::min(count - first, slice);
+            for (size_type i = 0; i < n; ++i) {
+                new (probes + i) value_type(keys[first + i], mapped_type());
+            }
+            lookup(std::launder(probes), first, n);
+            for (size_type i = 0; i < n; ++i) {
+                std::launder(probes + i)->~value_type();
+            }
+        }
+    }
+
+    template <class K, class V, class Pred>
+    friend typename map<K, V>::size_type erase_if(map<K, V> &c, Pred pred);
 };
+
+template <class Key, class T, class Pred>
+typename map<Key, T>::size_type erase_if(map<Key, T> &c, Pred pred) {
+    return c.data.erase_if(pred);
+}
 }  // namespace s21
 
 #endif  // SRC_S21_MAP_H_
@@ -0,0 +1,303 @@
+#ifndef SRC_S21_MPMC_QUEUE_H_
+#define SRC_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  bounded lock-free queue for any number of producers and consumers.
+ * every slot carries a sequence number that tells whose turn it is: a
+ * producer may fill slot pos when the sequence equals pos, a consumer may
+ * empty it when the sequence equals pos + 1. producers and consumers only
+ * compete for their own position counter.
+ * algorithm described here:
+ * https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ * push() and pop() block: they spin for a while, then yield, then park on a
+ * condition variable that the other side only signals when somebody is
+ * parked  */
+template <class T>
+struct mpmc_queue {
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+    explicit mpmc_queue(size_type capacity);
+    mpmc_queue(mpmc_queue const &q) = delete;
+    ~mpmc_queue();
+
+    mpmc_queue &operator=(mpmc_queue const &q) = delete;
+
+    bool empty() const;
+    size_type size() const;
+    size_type capacity() const noexcept;
+    /*  exact only while no push or pop is running  */
+    memory_footprint memory_usage() const;
+
+    bool try_push(const_reference value);
+    bool try_push(value_type &&value);
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+    bool try_pop(reference value);
+
+    void push(const_reference value);
+    void push(value_type &&value);
+    template <typename... Args>
+    void emplace_back(Args &&...args);
+    void pop(reference value);
+
+ private:
+    static size_type const _cache_line = 64;
+    static int const _spins = 64;
+    static int const _yields = 16;
+
+    struct _Cell {
+        std::atomic<size_type> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() noexcept { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+
+    size_type _mask;
+    _Cell *_cells;
+
+    std::allocator<_Cell> _a;
+    using _Mpmc_queue_manager = std::allocator_traits<std::allocator<_Cell>>;
+
+    alignas(_cache_line) std::atomic<size_type> _enqueue_pos;
+    alignas(_cache_line) std::atomic<size_type> _dequeue_pos;
+
+    alignas(_cache_line) std::mutex _park;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::atomic<size_type> _parked_consumers;
+    std::atomic<size_type> _parked_producers;
+
+    template <typename... Args>
+    bool _enqueue(Args &&...args);
+    bool _dequeue(reference value);
+    template <typename Try>
+    static bool _spin(Try attempt);
+    void _wake(std::atomic<size_type> &parked, std::condition_variable &cv);
+};
+
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity)
+    : _mask(0),
+      _cells(nullptr),
+      _enqueue_pos(0),
+      _dequeue_pos(0),
+      _parked_consumers(0),
+      _parked_producers(0) {
+    size_type slots = 2;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    _mask = slots - 1;
+    _cells = _Mpmc_queue_manager::allocate(_a, slots);
+    S21_TRACK_ALLOCATED("mpmc_queue", slots * sizeof(_Cell));
+    for (size_type i = 0; i < slots; ++i) {
+        new (&_cells[i].sequence) std::atomic<size_type>(i);
+    }
+}
+
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+    size_type end = _enqueue_pos.load(std::memory_order_relaxed);
+    for (size_type pos = _dequeue_pos.load(std::memory_order_relaxed); pos != end; ++pos) {
+        _cells[pos & _mask].value()->~T();
+    }
+    for (size_type i = 0; i <= _mask; ++i) {
+        _cells[i].sequence.~atomic();
+    }
+    _Mpmc_queue_manager::deallocate(_a, _cells, _mask + 1);
+    S21_TRACK_RELEASED("mpmc_queue", (_mask + 1) * sizeof(_Cell));
+}
+
+template <typename T>
+bool mpmc_queue<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size() const {
+    size_type head = _dequeue_pos.load(std::memory_order_acquire);
+    size_type tail = _enqueue_pos.load(std::memory_order_acquire);
+    return (tail > head) ? tail - head : 0;
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::capacity() const noexcept {
+    return _mask + 1;
+}
+
+template <typename T>
+memory_footprint mpmc_queue<T>::memory_usage() const {
+    /*  the sequence number of every cell is metadata  */
+    size_type cells = _mask + 1;
+    memory_footprint usage = buffer_footprint(size(), cells, sizeof(T));
+    usage.metadata += sizeof(*this) + cells * (sizeof(_Cell) - sizeof(T));
+    usage.overhead = heap_block_overhead(cells * sizeof(_Cell));
+    return usage;
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(const_reference value) {
+    return try_emplace(value);
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(value_type &&value) {
+    return try_emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args &&...args) {
+    bool pushed = _enqueue(std::forward<Args>(args)...);
+    if (pushed) {
+        _wake(_parked_consumers, _not_empty);
+    }
+    return pushed;
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_pop(reference value) {
+    bool popped = _dequeue(value);
+    if (popped) {
+        _wake(_parked_producers, _not_full);
+    }
+    return popped;
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::_enqueue(Args &&...args) {
+    size_type pos = _enqueue_pos.load(std::memory_order_relaxed);
+    _Cell *cell = nullptr;
+    while (cell == nullptr) {
+        _Cell *candidate = &_cells[pos & _mask];
+        size_type sequence = candidate->sequence.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell = candidate;
+            }
+        } else if (sequence < pos) {
+            return false;
+        } else {
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    new (cell->storage) T(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool mpmc_queue<T>::_dequeue(reference value) {
+    size_type pos = _dequeue_pos.load(std::memory_order_relaxed);
+    _Cell *cell = nullptr;
+    while (cell == nullptr) {
+        _Cell *candidate = &_cells[pos & _mask];
+        size_type sequence = candidate->sequence.load(std::memory_order_acquire);
+        if (sequence == pos + 1) {
+            if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell = candidate;
+            }
+        } else if (sequence < pos + 1) {
+            return false;
+        } else {
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    value = std::move(*cell->value());
+    cell->value()->~T();
+    cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+void mpmc_queue<T>::push(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename T>
+void mpmc_queue<T>::push(value_type &&value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+void mpmc_queue<T>::emplace_back(Args &&...args) {
+    /*  the arguments are only consumed by the attempt that succeeds. a
+     * parked thread retries under the mutex and signals the other side
+     * only after letting it go  */
+    if (!_spin([&]() { return try_emplace(std::forward<Args>(args)...); })) {
+        std::unique_lock<std::mutex> lock(_park);
+        _parked_producers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!_enqueue(std::forward<Args>(args)...)) {
+            _not_full.wait(lock);
+        }
+        _parked_producers.fetch_sub(1, std::memory_order_relaxed);
+        lock.unlock();
+        _wake(_parked_consumers, _not_empty);
+    }
+}
+
+template <typename T>
+void mpmc_queue<T>::pop(reference value) {
+    if (!_spin([&]() { return try_pop(value); })) {
+        std::unique_lock<std::mutex> lock(_park);
+        _parked_consumers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!_dequeue(value)) {
+            _not_empty.wait(lock);
+        }
+        _parked_consumers.fetch_sub(1, std::memory_order_relaxed);
+        lock.unlock();
+        _wake(_parked_producers, _not_full);
+    }
+}
+
+template <typename T>
+template <typename Try>
+bool mpmc_queue<T>::_spin(Try attempt) {
+    for (int i = 0; i < _spins; ++i) {
+        if (attempt()) {
+            return true;
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    for (int i = 0; i < _yields; ++i) {
+        if (attempt()) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+template <typename T>
+void mpmc_queue<T>::_wake(std::atomic<size_type> &parked, std::condition_variable &cv) {
+    /*  pairs with the fence a parking thread issues after registering, either
+     * this thread sees it parked or it sees the slot this thread just
+     * published. taking the mutex makes sure it is already waiting  */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(_park);
+        cv.notify_one();
+    }
+}
+}  // namespace s21
+
+#endif  // SRC_S21_MPMC_QUEUE_H_
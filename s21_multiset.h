@@ -46,11 +46,21 @@ class multiset {
         return data.insert(value);
     }
     void erase(iterator pos) { data.erase(pos); }
+    void erase(iterator first, iterator last) { data.erase(first, last); }
+    size_type erase(const key_type &key) { return data.erase(key); }
     void swap(multiset &other) { data.swap(other.data); }
     void merge(multiset &other) { data.merge(other.data); }
 
     iterator find(const key_type &key) { return data.find(key); }
     bool contains(const key_type &key) { return data.contains(key); }
+    template <size_type Lanes = RBTree<value_type>::lookup_lanes>
+    void find_many(const key_type *keys, size_type count, iterator *out) {
+        data.template find_many<Lanes>(keys, count, out);
+    }
+    template <size_type Lanes = RBTree<value_type>::lookup_lanes>
+    void contains_many(const key_type *keys, size_type count, bool *out) {
+        data.template contains_many<Lanes>(keys, count, out);
+    }
     size_type count(const key_type &key) { return data.count(key); }
     std::pair<iterator, iterator> equal_range(const key_type &key) {
         return data.equal_range(key);
@@ -63,9 +73,20 @@ class multiset {
         return data.emplace(args...);
     }
 
+    container_stats stats() const { return data.stats(); }
+    memory_footprint memory_usage() const { return data.memory_usage(); }
+
  private:
     RBTree<value_type, std::less_equal<key_type>> data;
+
+    template <class U, class Pred>
+    friend typename multiset<U>::size_type erase_if(multiset<U> &c, Pred pred);
 };
+
+template <class T, class Pred>
+typename multiset<T>::size_type erase_if(multiset<T> &c, Pred pred) {
+    return c.data.erase_if(pred);
+}
 }  // namespace s21
 
 #endif  // SRC_S21_MULTISET_H_
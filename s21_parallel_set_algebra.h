@@ -0,0 +1,88 @@
+#ifndef SRC_S21_PARALLEL_SET_ALGEBRA_H_
+#define SRC_S21_PARALLEL_SET_ALGEBRA_H_
+
+#include <cstddef>
+#include <utility>
+
+#include "ForkJoinPool.h"
+#include "s21_set.h"
+
+namespace s21 {
+/*  set_union, set_intersection and set_difference that fork the first
+ * levels of the join-based recursion onto ForkJoinPool::instance(), one
+ * level per doubling of threads. threads == 0 uses every pool worker once
+ * the two sets hold parallel_cutoff keys between them and stays on the
+ * calling thread below that, so small sets never start the pool  */
+template <class T>
+set<T> set_union(set<T> &&lhs, set<T> &&rhs, std::size_t threads);
+template <class T>
+set<T> set_intersection(set<T> &&lhs, set<T> &&rhs, std::size_t threads);
+template <class T>
+set<T> set_difference(set<T> &&lhs, set<T> &&rhs, std::size_t threads);
+
+template <class T>
+struct _Parallel_set_algebra {
+    using size_type = std::size_t;
+
+    static size_type const parallel_cutoff = 1 << 15;
+
+    struct _Pool_fork {
+        template <typename Left, typename Right>
+        void operator()(Left &left, Right &right) const {
+            ForkJoinPool::instance().invoke(left, right);
+        }
+    };
+
+    static size_type depth(set<T> const &lhs, set<T> const &rhs, size_type threads) {
+        if (threads == 0) {
+            threads = 1;
+            if (lhs.size() + rhs.size() >= parallel_cutoff) {
+                threads = ForkJoinPool::instance().size();
+            }
+        }
+        size_type levels = 0;
+        while ((size_type(1) << levels) < threads) {
+            levels++;
+        }
+        return levels;
+    }
+
+    static set<T> unite(set<T> &&lhs, set<T> &&rhs, size_type threads) {
+        size_type levels = depth(lhs, rhs, threads);
+        set<T> result(std::move(lhs));
+        result.data.unite(rhs.data, levels, _Pool_fork());
+        return result;
+    }
+
+    static set<T> intersect(set<T> &&lhs, set<T> &&rhs, size_type threads) {
+        size_type levels = depth(lhs, rhs, threads);
+        set<T> result(std::move(lhs));
+        result.data.intersect(rhs.data, levels, _Pool_fork());
+        return result;
+    }
+
+    static set<T> subtract(set<T> &&lhs, set<T> &&rhs, size_type threads) {
+        size_type levels = depth(lhs, rhs, threads);
+        set<T> result(std::move(lhs));
+        result.data.subtract(rhs.data, levels, _Pool_fork());
+        return result;
+    }
+};
+
+template <class T>
+set<T> set_union(set<T> &&lhs, set<T> &&rhs, std::size_t threads) {
+    return _Parallel_set_algebra<T>::unite(std::move(lhs), std::move(rhs), threads);
+}
+
+template <class T>
+set<T> set_intersection(set<T> &&lhs, set<T> &&rhs, std::size_t threads) {
+    return _Parallel_set_algebra<T>::intersect(std::move(lhs), std::move(rhs), threads);
+}
+
+template <class T>
+set<T> set_difference(set<T> &&lhs, set<T> &&rhs, std::size_t threads) {
+    return _Parallel_set_algebra<T>::subtract(std::move(lhs), std::move(rhs), threads);
+}
+}  // namespace s21
+
+#endif  // SRC_S21_PARALLEL_SET_ALGEBRA_H_
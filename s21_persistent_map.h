@@ -0,0 +1,93 @@
+#ifndef SRC_S21_PERSISTENT_MAP_H_
+#define SRC_S21_PERSISTENT_MAP_H_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "PersistentRBTree.h"
+
+namespace s21 {
+template <class Key, class T>
+class persistent_map {
+ public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+
+    struct cmp_pair_by_key {
+        bool operator()(const_reference a, const_reference b) const {
+            return a.first < b.first;
+        }
+    };
+    using iterator = typename PersistentRBTree<value_type, cmp_pair_by_key>::const_iterator;
+    using const_iterator = typename PersistentRBTree<value_type, cmp_pair_by_key>::const_iterator;
+    using size_type = std::size_t;
+
+    /*  every version is an immutable value: copying one is O(1), and insert,
+     * insert_or_assign and erase leave it unchanged and return a new version
+     * that shares all but O(log n) nodes with it  */
+    persistent_map() {}
+    explicit persistent_map(std::initializer_list<value_type> const &items) : data(items) {}
+    template <typename InputIt>
+    persistent_map(InputIt first, InputIt last) : data(first, last) {}
+    persistent_map(const persistent_map &m) : data(m.data) {}
+    persistent_map(persistent_map &&m) : data(std::move(m.data)) {}
+    ~persistent_map() {}
+    persistent_map &operator=(const persistent_map &m) {
+        data = m.data;
+        return *this;
+    }
+    persistent_map &operator=(persistent_map &&m) {
+        data = std::move(m.data);
+        return *this;
+    }
+
+    const_iterator begin() const noexcept { return data.begin(); }
+    const_iterator end() const noexcept { return data.end(); }
+
+    bool empty() const noexcept { return data.empty(); }
+    size_type size() const noexcept { return data.size(); }
+    size_type max_size() const noexcept { return data.max_size(); }
+    memory_footprint memory_usage() const { return data.memory_usage(); }
+
+    persistent_map insert(const value_type &value) const {
+        return persistent_map(data.insert(value));
+    }
+    persistent_map insert(const Key &key, const T &obj) const {
+        return persistent_map(data.insert(value_type(key, obj)));
+    }
+    persistent_map insert_or_assign(const Key &key, const T &obj) const {
+        return persistent_map(data.insert_or_assign(value_type(key, obj)));
+    }
+    persistent_map erase(const key_type &key) const {
+        return persistent_map(data.erase(_probe(key)));
+    }
+    void swap(persistent_map &other) noexcept { data.swap(other.data); }
+
+    const mapped_type &at(const key_type &key) const {
+        auto it = data.find(_probe(key));
+        if (it == data.end()) {
+            throw std::out_of_range("no such key in current map");
+        }
+        return (*it).second;
+    }
+    const mapped_type &operator[](const key_type &key) const { return at(key); }
+    const_iterator find(const key_type &key) const { return data.find(_probe(key)); }
+    bool contains(const key_type &key) const { return data.contains(_probe(key)); }
+    size_type count(const key_type &key) const { return data.count(_probe(key)); }
+    const_iterator lower_bound(const key_type &key) const { return data.lower_bound(_probe(key)); }
+    const_iterator upper_bound(const key_type &key) const { return data.upper_bound(_probe(key)); }
+
+ private:
+    PersistentRBTree<value_type, cmp_pair_by_key> data;
+
+    explicit persistent_map(PersistentRBTree<value_type, cmp_pair_by_key> &&tree) : data(std::move(tree)) {}
+
+    static value_type _probe(const key_type &key) { return value_type(key, mapped_type()); }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_PERSISTENT_MAP_H_
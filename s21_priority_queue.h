@@ -0,0 +1,214 @@
+#ifndef SRC_S21_PRIORITY_QUEUE_H_
+#define SRC_S21_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+/*  implicit d-ary max-heap on a random access container: the children of
+ * element i are Arity * i + 1 ... Arity * i + Arity. a 4-ary heap is half
+ * as deep as a binary one and the children of a node share a cache line,
+ * which pays off for pop() on big heaps. top() is the greatest element
+ * according to Compare, use std::greater for a min-heap  */
+template <class T, class Container = vector<T>, class Compare = std::less<T>, std::size_t Arity = 2>
+struct priority_queue {
+    using container_type = Container;
+    using value_compare = Compare;
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+    static_assert(Arity >= 2, "priority_queue needs an arity of at least 2");
+
+    priority_queue();
+    explicit priority_queue(Compare const &compare);
+    explicit priority_queue(std::initializer_list<value_type> const &items);
+    template <typename InputIt>
+    priority_queue(InputIt first, InputIt last, Compare const &compare = Compare());
+    priority_queue(priority_queue const &q);
+    priority_queue(priority_queue &&q);
+    ~priority_queue();
+
+    priority_queue &operator=(priority_queue &&q);
+
+    const_reference top() const;
+
+    bool empty() const;
+    size_type size() const;
+    memory_footprint memory_usage() const;
+
+    void push(const_reference value);
+    void push(value_type &&value);
+    void pop();
+    void swap(priority_queue &q);
+
+    template <typename... Args>
+    void emplace(Args &&...args);
+
+ private:
+    Container c;
+    Compare comp;
+
+    void _heapify();
+    void _sift_up(size_type i);
+    void _sift_down(size_type i);
+};
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue() : c(), comp() {
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(Compare const &compare) : c(), comp(compare) {
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(std::initializer_list<value_type> const &items)
+    : priority_queue(items.begin(), items.end()) {
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename InputIt>
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIt first, InputIt last,
+                                                             Compare const &compare)
+    : c(), comp(compare) {
+    for (; first != last; ++first) {
+        c.push_back(*first);
+    }
+    _heapify();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(priority_queue const &q) : c(q.c), comp(q.comp) {
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(priority_queue &&q)
+    : c(std::move(q.c)), comp(std::move(q.comp)) {
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::~priority_queue() {
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity> &priority_queue<T, Container, Compare, Arity>::operator=(
+    priority_queue &&q) {
+    if (this != &q) {
+        priority_queue(std::move(q)).swap(*this);
+    }
+    return *this;
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::const_reference
+priority_queue<T, Container, Compare, Arity>::top() const {
+    return c.front();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+bool priority_queue<T, Container, Compare, Arity>::empty() const {
+    return c.empty();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::size_type
+priority_queue<T, Container, Compare, Arity>::size() const {
+    return c.size();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+memory_footprint priority_queue<T, Container, Compare, Arity>::memory_usage() const {
+    memory_footprint usage = c.memory_usage();
+    usage.metadata += sizeof(*this) - sizeof(Container);
+    return usage;
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(const_reference value) {
+    c.push_back(value);
+    _sift_up(c.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(value_type &&value) {
+    c.push_back(std::move(value));
+    _sift_up(c.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args) {
+    push(value_type(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+    if (c.size() > 1) {
+        c[0] = std::move(c[c.size() - 1]);
+        c.pop_back();
+        _sift_down(0);
+    } else {
+        c.pop_back();
+    }
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::swap(priority_queue &q) {
+    c.swap(q.c);
+    std::swap(comp, q.comp);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::_heapify() {
+    /*  Floyd's bottom-up construction: sifting down every inner node from
+     * the last one costs O(n) in total  */
+    size_type n = c.size();
+    if (n > 1) {
+        for (size_type i = (n - 2) / Arity + 1; i > 0; --i) {
+            _sift_down(i - 1);
+        }
+    }
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::_sift_up(size_type i) {
+    /*  moves a hole up instead of swapping, one move per level  */
+    value_type value = std::move(c[i]);
+    while (i > 0) {
+        size_type parent = (i - 1) / Arity;
+        if (!comp(c[parent], value)) {
+            break;
+        }
+        c[i] = std::move(c[parent]);
+        i = parent;
+    }
+    c[i] = std::move(value);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::_sift_down(size_type i) {
+    size_type n = c.size();
+    value_type value = std::move(c[i]);
+    for (size_type first = Arity * i + 1; first < n; first = Arity * i + 1) {
+        size_type last = (n - first < Arity) ? n : first + Arity;
+        size_type best = first;
+        for (size_type child = first + 1; child < last; ++child) {
+            if (comp(c[best], c[child])) {
+                best = child;
+            }
+        }
+        if (!comp(value, c[best])) {
+            break;
+        }
+        c[i] = std::move(c[best]);
+        i = best;
+    }
+    c[i] = std::move(value);
+}
+}  // namespace s21
+
+#endif  // SRC_S21_PRIORITY_QUEUE_H_
@@ -36,6 +36,9 @@ struct queue {
     template <typename... Args>
     void emplace_back(Args &&...args);
 
+    container_stats stats() const;
+    memory_footprint memory_usage() const;
+
  private:
     list<T> l;
 };
@@ -118,6 +121,16 @@ template <typename... Args>
 void queue<T>::emplace_back(Args &&...args) {
     l.emplace_back(args...);
 }
+
+template <typename T>
+container_stats queue<T>::stats() const {
+    return l.stats();
+}
+
+template <typename T>
+memory_footprint queue<T>::memory_usage() const {
+    return l.memory_usage();
+}
 }  // namespace s21
 
 #endif  // SRC_S21_QUEUE_H_
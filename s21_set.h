@@ -5,8 +5,33 @@
 #include <utility>
 
 #include "RBTree.h"
+#include "s21_frozen_set.h"
 
 namespace s21 {
+template <class T>
+class set;
+
+template <class T>
+struct _Parallel_set_algebra;
+
+/*  the rvalue overloads take both trees apart and cost O(m log(n / m + 1)),
+ * callers that no longer need their sets should move them in. the const&
+ * overloads leave the inputs untouched and copy the result's keys.
+ * s21_parallel_set_algebra.h adds rvalue overloads that take a thread
+ * count  */
+template <class T>
+set<T> set_union(set<T> &&lhs, set<T> &&rhs);
+template <class T>
+set<T> set_intersection(set<T> &&lhs, set<T> &&rhs);
+template <class T>
+set<T> set_difference(set<T> &&lhs, set<T> &&rhs);
+template <class T>
+set<T> set_union(set<T> const &lhs, set<T> const &rhs);
+template <class T>
+set<T> set_intersection(set<T> const &lhs, set<T> const &rhs);
+template <class T>
+set<T> set_difference(set<T> const &lhs, set<T> const &rhs);
+
 template <class T>
 class set {
  public:
@@ -43,19 +68,103 @@ class set {
         return data.insert(value);
     }
     void erase(iterator pos) { data.erase(pos); }
+    void erase(iterator first, iterator last) { data.erase(first, last); }
+    size_type erase(const key_type &key) { return data.erase(key); }
     void swap(set &other) { data.swap(other.data); }
     void merge(set &other) { data.merge(other.data); }
+    set split(const key_type &key) {
+        set right;
+        RBTree<value_type> tmp = data.split(key);
+        right.data.swap(tmp);
+        return right;
+    }
+    void join(set &other) { data.join(other.data); }
 
     iterator find(const key_type &key) { return data.find(key); }
     bool contains(const key_type &key) { return data.contains(key); }
+    template <size_type Lanes = RBTree<value_type>::lookup_lanes>
+    void find_many(const key_type *keys, size_type count, iterator *out) {
+        data.template find_many<Lanes>(keys, count, out);
+    }
+    template <size_type Lanes = RBTree<value_type>::lookup_lanes>
+    void contains_many(const key_type *keys, size_type count, bool *out) {
+        data.template contains_many<Lanes>(keys, count, out);
+    }
+    iterator lower_bound(const key_type &key) { return data.lower_bound(key); }
+    iterator upper_bound(const key_type &key) { return data.upper_bound(key); }
+
+    frozen_set<value_type> freeze() const {
+        return frozen_set<value_type>(typename frozen_set<value_type>::_Sorted_unique(), data.begin(),
+                                       data.end());
+    }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace(Args &&...args) {
         return data.emplace(args...);
     }
 
+    container_stats stats() const { return data.stats(); }
+    memory_footprint memory_usage() const { return data.memory_usage(); }
+
  private:
     RBTree<value_type> data;
+
+    template <class U, class Pred>
+    friend typename set<U>::size_type erase_if(set<U> &c, Pred pred);
+    friend struct _Parallel_set_algebra<T>;
+    friend set set_union<>(set &&lhs, set &&rhs);
+    friend set set_intersection<>(set &&lhs, set &&rhs);
+    friend set set_difference<>(set &&lhs, set &&rhs);
+    friend set set_union<>(set const &lhs, set const &rhs);
+    friend set set_intersection<>(set const &lhs, set const &rhs);
+    friend set set_difference<>(set const &lhs, set const &rhs);
 };
+
+template <class T, class Pred>
+typename set<T>::size_type erase_if(set<T> &c, Pred pred) {
+    return c.data.erase_if(pred);
+}
+
+template <class T>
+set<T> set_union(set<T> &&lhs, set<T> &&rhs) {
+    set<T> result(std::move(lhs));
+    result.data.unite(rhs.data);
+    return result;
+}
+
+template <class T>
+set<T> set_intersection(set<T> &&lhs, set<T> &&rhs) {
+    set<T> result(std::move(lhs));
+    result.data.intersect(rhs.data);
+    return result;
+}
+
+template <class T>
+set<T> set_difference(set<T> &&lhs, set<T> &&rhs) {
+    set<T> result(std::move(lhs));
+    result.data.subtract(rhs.data);
+    return result;
+}
+
+template <class T>
+set<T> set_union(set<T> const &lhs, set<T> const &rhs) {
+    set<T> result;
+    result.data.assign_union(lhs.data, rhs.data);
+    return result;
+}
+
+template <class T>
+set<T> set_intersection(set<T> const &lhs, set<T> const &rhs) {
+    set<T> result;
+    result.data.assign_intersection(lhs.data, rhs.data);
+    return result;
+}
+
+template <class T>
+set<T> set_difference(set<T> const &lhs, set<T> const &rhs) {
+    set<T> result;
+    result.data.assign_difference(lhs.data, rhs.data);
+    return result;
+}
 }  // namespace s21
 #endif  // SRC_S21_SET_H_
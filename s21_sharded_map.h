@@ -0,0 +1,172 @@
+#ifndef SRC_S21_SHARDED_MAP_H_
+#define SRC_S21_SHARDED_MAP_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_map.h"
+
+namespace s21 {
+/*  write-heavy map shared between threads. keys are hashed to Shards
+ * independent s21::map shards, each behind its own mutex on its own cache
+ * line, so writers to different shards never wait for each other.
+ * single-key operations lock one shard, size() and for_each() lock the
+ * shards one at a time, for_each_ordered() locks all of them at once and
+ * sees one consistent state  */
+template <class Key, class T, std::size_t Shards = 16, class Hash = std::hash<Key>>
+class sharded_map {
+ public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+    static_assert(Shards > 0, "sharded_map needs at least one shard");
+
+    sharded_map() {}
+    explicit sharded_map(std::initializer_list<value_type> const &items) {
+        for (auto it = items.begin(); it != items.end(); ++it) {
+            insert(it->first, it->second);
+        }
+    }
+    sharded_map(const sharded_map &m) = delete;
+    sharded_map &operator=(const sharded_map &m) = delete;
+    ~sharded_map() {}
+
+    bool empty() const { return size() == 0; }
+    size_type size() const {
+        size_type count = 0;
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            count += shard.data.size();
+        }
+        return count;
+    }
+    size_type shard_count() const noexcept { return Shards; }
+    /*  locks the shards one at a time like size()  */
+    memory_footprint memory_usage() const {
+        memory_footprint usage;
+        usage.metadata = sizeof(*this) - Shards * sizeof(_Shard_map);
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            usage += shard.data.memory_usage();
+        }
+        return usage;
+    }
+
+    void clear() {
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            shard.data.clear();
+        }
+    }
+    bool insert(const value_type &value) { return insert(value.first, value.second); }
+    bool insert(const Key &key, const T &obj) {
+        _Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return shard.data.insert(key, obj).second;
+    }
+    bool insert_or_assign(const Key &key, const T &obj) {
+        _Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return shard.data.insert_or_assign(key, obj).second;
+    }
+    size_type erase(const key_type &key) {
+        _Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return shard.data.erase(key);
+    }
+
+    std::optional<mapped_type> find(const key_type &key) const {
+        _Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        std::optional<mapped_type> result;
+        if (shard.data.contains(key)) {
+            result = shard.data.at(key);
+        }
+        return result;
+    }
+    mapped_type at(const key_type &key) const {
+        _Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return shard.data.at(key);
+    }
+    bool contains(const key_type &key) const {
+        _Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return shard.data.contains(key);
+    }
+
+    /*  visits every element, each shard under its own lock and in key order
+     * within the shard, but in no particular order across shards  */
+    template <typename Func>
+    void for_each(Func func) const {
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            for (auto it = shard.data.begin(); it != shard.data.end(); ++it) {
+                func(static_cast<const_reference>(*it));
+            }
+        }
+    }
+
+    /*  visits every element in key order: all shards are locked in index
+     * order and merged with a heap of shard indices. Shards is fixed, so the
+     * heap and the per-shard cursors live in arrays on the stack  */
+    template <typename Func>
+    void for_each_ordered(Func func) const {
+        std::array<std::unique_lock<std::mutex>, Shards> locks;
+        std::array<std::optional<typename _Shard_map::iterator>, Shards> cursors;
+        std::array<size_type, Shards> heap;
+        size_type count = 0;
+        for (size_type i = 0; i < Shards; ++i) {
+            locks[i] = std::unique_lock<std::mutex>(_shards[i].lock);
+            if (!_shards[i].data.empty()) {
+                cursors[i] = _shards[i].data.begin();
+                heap[count++] = i;
+            }
+        }
+        auto later = [&cursors](size_type a, size_type b) {
+            return (**cursors[b]).first < (**cursors[a]).first;
+        };
+        std::make_heap(heap.begin(), heap.begin() + count, later);
+        while (count > 0) {
+            std::pop_heap(heap.begin(), heap.begin() + count, later);
+            size_type shard = heap[count - 1];
+            auto &next = *cursors[shard];
+            func(static_cast<const_reference>(*next));
+            if (++next == _shards[shard].data.end()) {
+                --count;
+            } else {
+                std::push_heap(heap.begin(), heap.begin() + count, later);
+            }
+        }
+    }
+
+ private:
+    using _Shard_map = map<Key, T>;
+
+    struct alignas(64) _Shard {
+        std::mutex lock;
+        _Shard_map data;
+    };
+
+    mutable std::array<_Shard, Shards> _shards;
+
+    _Shard &_shard(const key_type &key) const {
+        /*  fibonacci hashing spreads identity hashes of nearby or strided
+         * keys over all shards  */
+        std::uint64_t h = static_cast<std::uint64_t>(Hash{}(key)) * 11400714819323198485ull;
+        return _shards[static_cast<size_type>(h >> 32) % Shards];
+    }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_SHARDED_MAP_H_
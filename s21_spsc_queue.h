@@ -0,0 +1,201 @@
+#ifndef SRC_S21_SPSC_QUEUE_H_
+#define SRC_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  bounded wait-free queue for exactly one producer thread and one consumer
+ * thread. the ring holds a power of two slots, head and tail count pushes
+ * and pops from the start and never wrap back. each side keeps its own
+ * index and a cached copy of the other one on its own cache line, and only
+ * reloads the other side's index when the cached copy says the ring is full
+ * (or empty). design described here:
+ * https://rigtorp.se/ringbuffer/ */
+template <class T>
+struct spsc_queue {
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using size_type = std::size_t;
+
+    explicit spsc_queue(size_type capacity);
+    spsc_queue(spsc_queue const &q) = delete;
+    ~spsc_queue();
+
+    spsc_queue &operator=(spsc_queue const &q) = delete;
+
+    bool empty() const;
+    size_type size() const;
+    size_type capacity() const noexcept;
+    /*  exact only while neither side is running  */
+    memory_footprint memory_usage() const;
+
+    /*  producer side  */
+    bool try_push(const_reference value);
+    bool try_push(value_type &&value);
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+    template <typename InputIt>
+    size_type try_push_n(InputIt first, size_type count);
+
+    /*  consumer side  */
+    bool try_pop(reference value);
+    template <typename OutputIt>
+    size_type try_pop_n(OutputIt out, size_type max_count);
+
+ private:
+    static size_type const _cache_line = 64;
+
+    size_type _mask;
+    T *_ring;
+
+    std::allocator<T> _a;
+    using _Spsc_queue_manager = std::allocator_traits<std::allocator<T>>;
+
+    alignas(_cache_line) std::atomic<size_type> _head;
+    size_type _tail_cache;
+
+    alignas(_cache_line) std::atomic<size_type> _tail;
+    size_type _head_cache;
+
+    size_type _free_slots(size_type tail, size_type wanted);
+    size_type _ready_slots(size_type head, size_type wanted);
+};
+
+template <typename T>
+spsc_queue<T>::spsc_queue(size_type capacity)
+    : _mask(0), _ring(nullptr), _head(0), _tail_cache(0), _tail(0), _head_cache(0) {
+    size_type slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    _mask = slots - 1;
+    _ring = _Spsc_queue_manager::allocate(_a, slots);
+    S21_TRACK_ALLOCATED("spsc_queue", slots * sizeof(T));
+}
+
+template <typename T>
+spsc_queue<T>::~spsc_queue() {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    for (size_type i = _head.load(std::memory_order_relaxed); i != tail; ++i) {
+        _Spsc_queue_manager::destroy(_a, _ring + (i & _mask));
+    }
+    _Spsc_queue_manager::deallocate(_a, _ring, _mask + 1);
+    S21_TRACK_RELEASED("spsc_queue", (_mask + 1) * sizeof(T));
+}
+
+template <typename T>
+bool spsc_queue<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::size() const {
+    size_type head = _head.load(std::memory_order_acquire);
+    size_type tail = _tail.load(std::memory_order_acquire);
+    return (tail > head) ? tail - head : 0;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::capacity() const noexcept {
+    return _mask + 1;
+}
+
+template <typename T>
+memory_footprint spsc_queue<T>::memory_usage() const {
+    memory_footprint usage = buffer_footprint(size(), _mask + 1, sizeof(T));
+    usage.metadata += sizeof(*this);
+    return usage;
+}
+
+template <typename T>
+bool spsc_queue<T>::try_push(const_reference value) {
+    return try_emplace(value);
+}
+
+template <typename T>
+bool spsc_queue<T>::try_push(value_type &&value) {
+    return try_emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool spsc_queue<T>::try_emplace(Args &&...args) {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    if (_free_slots(tail, 1) == 0) {
+        return false;
+    }
+    _Spsc_queue_manager::construct(_a, _ring + (tail & _mask), std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+template <typename InputIt>
+typename spsc_queue<T>::size_type spsc_queue<T>::try_push_n(InputIt first, size_type count) {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    count = _free_slots(tail, count);
+    for (size_type i = 0; i < count; ++i, ++first) {
+        _Spsc_queue_manager::construct(_a, _ring + ((tail + i) & _mask), *first);
+    }
+    if (count > 0) {
+        _tail.store(tail + count, std::memory_order_release);
+    }
+    return count;
+}
+
+template <typename T>
+bool spsc_queue<T>::try_pop(reference value) {
+    size_type head = _head.load(std::memory_order_relaxed);
+    if (_ready_slots(head, 1) == 0) {
+        return false;
+    }
+    T *slot = _ring + (head & _mask);
+    value = std::move(*slot);
+    _Spsc_queue_manager::destroy(_a, slot);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+template <typename OutputIt>
+typename spsc_queue<T>::size_type spsc_queue<T>::try_pop_n(OutputIt out, size_type max_count) {
+    size_type head = _head.load(std::memory_order_relaxed);
+    size_type count = _ready_slots(head, max_count);
+    for (size_type i = 0; i < count; ++i, ++out) {
+        T *slot = _ring + ((head + i) & _mask);
+        *out = std::move(*slot);
+        _Spsc_queue_manager::destroy(_a, slot);
+    }
+    if (count > 0) {
+        _head.store(head + count, std::memory_order_release);
+    }
+    return count;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::_free_slots(size_type tail, size_type wanted) {
+    size_type room = _mask + 1 - (tail - _head_cache);
+    if (room < wanted) {
+        _head_cache = _head.load(std::memory_order_acquire);
+        room = _mask + 1 - (tail - _head_cache);
+    }
+    return (room < wanted) ? room : wanted;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::_ready_slots(size_type head, size_type wanted) {
+    size_type ready = _tail_cache - head;
+    if (ready < wanted) {
+        _tail_cache = _tail.load(std::memory_order_acquire);
+        ready = _tail_cache - head;
+    }
+    return (ready < wanted) ? ready : wanted;
+}
+}  // namespace s21
+
+#endif  // SRC_S21_SPSC_QUEUE_H_
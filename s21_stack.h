@@ -34,6 +34,9 @@ struct stack {
     template <typename... Args>
     void emplace_front(Args &&...args);
 
+    container_stats stats() const;
+    memory_footprint memory_usage() const;
+
  private:
     list<T> l;
 };
@@ -106,6 +109,16 @@ template <typename... Args>
 void stack<T>::emplace_front(Args &&...args) {
     l.emplace_front(args...);
 }
+
+template <typename T>
+container_stats stack<T>::stats() const {
+    return l.stats();
+}
+
+template <typename T>
+memory_footprint stack<T>::memory_usage() const {
+    return l.memory_usage();
+}
 }  // namespace s21
 
 #endif  // SRC_S21_STACK_H_
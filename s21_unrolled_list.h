@@ -0,0 +1,530 @@
+#ifndef SRC_S21_UNROLLED_LIST_H_
+#define SRC_S21_UNROLLED_LIST_H_
+
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "MemoryUsage.h"
+
+namespace s21 {
+/*  a doubly linked list of blocks holding up to N elements each. scans walk
+ * contiguous arrays and pay one pointer chase per block, push_front and
+ * push_back stay O(1), an insertion or an erasure moves at most N elements
+ * of one block. like a deque, inserting into or erasing from a block
+ * invalidates the iterators into that block and its new neighbour, the
+ * other blocks are untouched  */
+template <typename T, std::size_t N = 32>
+struct unrolled_list {
+    static_assert(N >= 2, "unrolled_list needs at least 2 elements per block");
+
+ private:
+    struct _Unrolled_link;
+    struct _Unrolled_block;
+    struct _Unrolled_iterator;
+    struct _Unrolled_const_iterator;
+
+ public:
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using iterator = _Unrolled_iterator;
+    using const_iterator = _Unrolled_const_iterator;
+    using size_type = std::size_t;
+
+    static size_type const block_capacity = N;
+
+    unrolled_list();
+    explicit unrolled_list(size_type n);
+    explicit unrolled_list(std::initializer_list<value_type> const &items);
+    unrolled_list(unrolled_list const &l);
+    unrolled_list(unrolled_list &&l);
+    ~unrolled_list();
+
+    unrolled_list &operator=(unrolled_list &&l);
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    size_type blocks() const noexcept;
+
+    void clear();
+    iterator insert(const_iterator pos, const_reference value);
+    iterator erase(const_iterator pos);
+    void push_back(const_reference value);
+    void pop_back();
+    void push_front(const_reference value);
+    void pop_front();
+    void swap(unrolled_list &other);
+
+    container_stats stats() const;
+    memory_footprint memory_usage() const;
+
+ private:
+    size_type _size;
+    size_type _blocks;
+    _Unrolled_link *_head;
+
+    S21_STATS_COUNTERS
+
+    std::allocator<_Unrolled_block> _a;
+    using _Unrolled_block_manager = std::allocator_traits<std::allocator<_Unrolled_block>>;
+
+    _Unrolled_block *_new_block(_Unrolled_link *next);
+    void _free_block(_Unrolled_block *block);
+    _Unrolled_block *_split(_Unrolled_block *block);
+    iterator _make_room(_Unrolled_link *link, size_type index);
+
+    /*  the sentinel is a bare link with no elements, blocks add the storage  */
+    struct _Unrolled_link {
+        _Unrolled_link *_prev;
+        _Unrolled_link *_next;
+        size_type _count;
+
+        _Unrolled_link() noexcept : _prev(this), _next(this), _count(0) {
+        }
+
+        _Unrolled_block *_block() noexcept {
+            return static_cast<_Unrolled_block *>(this);
+        }
+
+        _Unrolled_block const *_block() const noexcept {
+            return static_cast<_Unrolled_block const *>(this);
+        }
+    };
+
+    struct _Unrolled_block : _Unrolled_link {
+        alignas(T) unsigned char _storage[N * sizeof(T)];
+
+        _Unrolled_block() noexcept {
+        }
+
+        T *_items() noexcept {
+            return std::launder(reinterpret_cast<T *>(_storage));
+        }
+
+        T const *_items() const noexcept {
+            return std::launder(reinterpret_cast<T const *>(_storage));
+        }
+
+        /*  moves the elements from index on to the end of another block  */
+        void _move_tail(size_type index, _Unrolled_block *to) {
+            T *items = _items();
+            T *dest = to->_items() + to->_count;
+            for (size_type i = index; i < this->_count; ++i) {
+                new (dest++) T(std::move(items[i]));
+                items[i].~T();
+            }
+            to->_count += this->_count - index;
+            this->_count = index;
+        }
+    };
+
+    struct _Unrolled_iterator {
+        using _Self = _Unrolled_iterator;
+
+        _Unrolled_link *_link;
+        size_type _index;
+
+        _Unrolled_iterator(_Unrolled_link *link, size_type index) noexcept : _link(link), _index(index) {
+        }
+
+        operator _Unrolled_const_iterator() const {
+            return _Unrolled_const_iterator(_link, _index);
+        }
+
+        reference operator*() const noexcept {
+            return _link->_block()->_items()[_index];
+        }
+
+        _Self &operator++() noexcept {
+            if (++_index >= _link->_count) {
+                _link = _link->_next;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        _Self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _Self &operator--() noexcept {
+            if (_index == 0) {
+                _link = _link->_prev;
+                _index = _link->_count;
+            }
+            --_index;
+            return *this;
+        }
+
+        _Self operator--(int) noexcept {
+            auto it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_Self const &other) const noexcept {
+            return _link == other._link && _index == other._index;
+        }
+
+        bool operator!=(_Self const &other) const noexcept {
+            return !(*this == other);
+        }
+    };
+
+    struct _Unrolled_const_iterator {
+        using _Self = _Unrolled_const_iterator;
+
+        _Unrolled_link const *_link;
+        size_type _index;
+
+        _Unrolled_const_iterator(_Unrolled_link const *link, size_type index) noexcept
+            : _link(link), _index(index) {
+        }
+
+        _Unrolled_iterator _const_cast() const noexcept {
+            return _Unrolled_iterator(const_cast<_Unrolled_link *>(_link), _index);
+        }
+
+        const_reference operator*() const noexcept {
+            return _link->_block()->_items()[_index];
+        }
+
+        _Self &operator++() noexcept {
+            if (++_index >= _link->_count) {
+                _link = _link->_next;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        _Self operator++(int) noexcept {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        _Self &operator--() noexcept {
+            if (_index == 0) {
+                _link = _link->_prev;
+                _index = _link->_count;
+            }
+            --_index;
+            return *this;
+        }
+
+        _Self operator--(int) noexcept {
+            auto it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(_Self const &other) const noexcept {
+            return _link == other._link && _index == other._index;
+        }
+
+        bool operator!=(_Self const &other) const noexcept {
+            return !(*this == other);
+        }
+    };
+};
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list() : _size(0), _blocks(0), _head(new _Unrolled_link()) {
+    S21_STATS_ADD(allocations, 1);
+    S21_TRACK_ALLOCATED("unrolled_list", sizeof(_Unrolled_link));
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(size_type n) : unrolled_list() {
+    while (n--) {
+        push_back(value_type());
+    }
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(std::initializer_list<value_type> const &items) : unrolled_list() {
+    for (auto it = items.begin(); it != items.end(); ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(unrolled_list const &l) : unrolled_list() {
+    for (auto it = l.begin(); it != l.end(); ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(unrolled_list &&l) : unrolled_list() {
+    swap(l);
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::~unrolled_list() {
+    clear();
+
+    delete _head;
+    S21_TRACK_RELEASED("unrolled_list", sizeof(_Unrolled_link));
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N> &unrolled_list<T, N>::operator=(unrolled_list &&l) {
+    if (this != &l) {
+        unrolled_list(std::move(l)).swap(*this);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::reference unrolled_list<T, N>::front() {
+    return const_cast<reference>(const_cast<unrolled_list const *>(this)->front());
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::const_reference unrolled_list<T, N>::front() const {
+    return _head->_next->_block()->_items()[0];
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::reference unrolled_list<T, N>::back() {
+    return const_cast<reference>(const_cast<unrolled_list const *>(this)->back());
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::const_reference unrolled_list<T, N>::back() const {
+    return _head->_prev->_block()->_items()[_head->_prev->_count - 1];
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::begin() noexcept {
+    return _Unrolled_iterator(_head->_next, 0);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::const_iterator unrolled_list<T, N>::begin() const noexcept {
+    return _Unrolled_const_iterator(_head->_next, 0);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::end() noexcept {
+    return _Unrolled_iterator(_head, 0);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::const_iterator unrolled_list<T, N>::end() const noexcept {
+    return _Unrolled_const_iterator(_head, 0);
+}
+
+template <typename T, std::size_t N>
+bool unrolled_list<T, N>::empty() const noexcept {
+    return _size == 0;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::size_type unrolled_list<T, N>::size() const noexcept {
+    return _size;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::size_type unrolled_list<T, N>::max_size() const noexcept {
+    return _Unrolled_block_manager::max_size(_a) * N;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::size_type unrolled_list<T, N>::blocks() const noexcept {
+    return _blocks;
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::clear() {
+    while (_head->_next != _head) {
+        _Unrolled_block *block = _head->_next->_block();
+        T *items = block->_items();
+        for (size_type i = 0; i < block->_count; ++i) {
+            items[i].~T();
+        }
+        _free_block(block);
+    }
+    _size = 0;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::insert(const_iterator pos,
+                                                                   const_reference value) {
+    /*  the copy is made before the list changes, so a throwing copy
+     * constructor leaves it as it was  */
+    T item(value);
+    S21_STATS_ADD(copies, 1);
+    iterator it = _make_room(pos._const_cast()._link, pos._index);
+    T *slot = it._link->_block()->_items() + it._index;
+    if (it._index < it._link->_count) {
+        *slot = std::move(item);
+    } else {
+        new (slot) T(std::move(item));
+        ++it._link->_count;
+    }
+    ++_size;
+    return it;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::_make_room(_Unrolled_link *link,
+                                                                       size_type index) {
+    /*  an insertion at the front of a block goes to the end of the previous
+     * one when that has room, so filling a list front to back or back to
+     * front never shifts. a full first block gets a fresh block in front of
+     * it, which keeps push_front O(1), any other full block is split in
+     * halves first  */
+    if (index == 0 && link->_prev != _head && link->_prev->_count < N) {
+        link = link->_prev;
+        index = link->_count;
+    } else if (link == _head) {
+        link = _new_block(_head);
+    } else if (index == 0 && link->_prev == _head && link->_count == N) {
+        link = _new_block(link);
+    } else if (link->_count == N) {
+        _Unrolled_block *upper = _split(link->_block());
+        if (index > link->_count) {
+            index -= link->_count;
+            link = upper;
+        }
+    }
+    /*  the elements from index on move up one slot, the one at index is
+     * left moved-from but alive and is assigned by insert(). at the end of
+     * the block the slot stays raw and is not counted yet  */
+    T *items = link->_block()->_items();
+    if (index < link->_count) {
+        new (items + link->_count) T(std::move(items[link->_count - 1]));
+        ++link->_count;
+        for (size_type i = link->_count - 2; i > index; --i) {
+            items[i] = std::move(items[i - 1]);
+        }
+    }
+    return _Unrolled_iterator(link, index);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::erase(const_iterator pos) {
+    /*  a block that drops to a quarter full takes in its successor when both
+     * fit in half a block, so blocks stay at least a quarter full on
+     * average and the list never degrades into one element per block  */
+    _Unrolled_link *link = pos._const_cast()._link;
+    size_type index = pos._index;
+    T *items = link->_block()->_items();
+    for (size_type i = index + 1; i < link->_count; ++i) {
+        items[i - 1] = std::move(items[i]);
+    }
+    items[link->_count - 1].~T();
+    --link->_count;
+    --_size;
+    _Unrolled_link *next = link->_next;
+    if (link->_count == 0) {
+        _free_block(link->_block());
+        link = next;
+        index = 0;
+    } else if (next != _head && link->_count <= N / 4 && link->_count + next->_count <= N / 2) {
+        next->_block()->_move_tail(0, link->_block());
+        _free_block(next->_block());
+    }
+    if (link != _head && index == link->_count) {
+        link = link->_next;
+        index = 0;
+    }
+    return _Unrolled_iterator(link, index);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::push_back(const_reference value) {
+    insert(end(), value);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::pop_back() {
+    if (!empty()) {
+        erase(--end());
+    }
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::push_front(const_reference value) {
+    insert(begin(), value);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::pop_front() {
+    if (!empty()) {
+        erase(begin());
+    }
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::swap(unrolled_list &other) {
+    std::swap(_head, other._head);
+    std::swap(_size, other._size);
+    std::swap(_blocks, other._blocks);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::_Unrolled_block *unrolled_list<T, N>::_new_block(_Unrolled_link *next) {
+    _Unrolled_block *block = _Unrolled_block_manager::allocate(_a, 1);
+    _Unrolled_block_manager::construct(_a, block);
+    S21_STATS_ADD(allocations, 1);
+    S21_TRACK_ALLOCATED("unrolled_list", sizeof(_Unrolled_block));
+    block->_prev = next->_prev;
+    block->_next = next;
+    next->_prev->_next = block;
+    next->_prev = block;
+    ++_blocks;
+    return block;
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::_free_block(_Unrolled_block *block) {
+    block->_prev->_next = block->_next;
+    block->_next->_prev = block->_prev;
+    _Unrolled_block_manager::destroy(_a, block);
+    _Unrolled_block_manager::deallocate(_a, block, 1);
+    S21_TRACK_RELEASED("unrolled_list", sizeof(_Unrolled_block));
+    --_blocks;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::_Unrolled_block *unrolled_list<T, N>::_split(_Unrolled_block *block) {
+    _Unrolled_block *upper = _new_block(block->_next);
+    block->_move_tail(block->_count / 2, upper);
+    return upper;
+}
+
+template <typename T, std::size_t N>
+container_stats unrolled_list<T, N>::stats() const {
+    return S21_STATS_SNAPSHOT();
+}
+
+template <typename T, std::size_t N>
+memory_footprint unrolled_list<T, N>::memory_usage() const {
+    memory_footprint usage = buffer_footprint(_size, _blocks * N, sizeof(T));
+    usage.overhead = _blocks * heap_block_overhead(sizeof(_Unrolled_block)) +
+                     heap_block_overhead(sizeof(_Unrolled_link));
+    usage.metadata =
+        sizeof(*this) + sizeof(_Unrolled_link) + _blocks * (sizeof(_Unrolled_block) - N * sizeof(T));
+    return usage;
+}
+}  // namespace s21
+
+#endif  // SRC_S21_UNROLLED_LIST_H_
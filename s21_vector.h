@@ -6,6 +6,9 @@
 #include <stdexcept>
 #include <utility>
 
+#include "ContainerStats.h"
+#include "MemoryUsage.h"
+
 namespace s21 {
 template <typename T>
 struct vector {
@@ -59,17 +62,23 @@ struct vector {
     iterator emplace(const_iterator pos, Args &&...args);
     void erase(iterator pos);
     void push_back(const_reference value);
+    void push_back(value_type &&value);
     template <typename... Args>
     void emplace_back(Args &&...args);
     void pop_back();
     void swap(vector &other);
 
+    container_stats stats() const;
+    memory_footprint memory_usage() const;
+
  private:
     size_type _size, _capacity;
     T *_head;
 
     static size_type const _min_capacity = 32;
 
+    S21_STATS_COUNTERS
+
     std::allocator<T> _a;
     using _Vector_manager = std::allocator_traits<std::allocator<T>>;
 
@@ -174,12 +183,16 @@ struct vector {
 
 template <typename T>
 vector<T>::vector() : _size(0), _capacity(_min_capacity), _head(_Vector_manager::allocate(_a, _capacity)) {
+    S21_STATS_ADD(allocations, 1);
+    S21_TRACK_ALLOCATED("vector", _capacity * sizeof(T));
 }
 
 template <typename T>
 vector<T>::vector(size_type n) : _size(n),
                                  _capacity((_size + _min_capacity) * 2),
                                  _head(_Vector_manager::allocate(_a, _capacity)) {
+    S21_STATS_ADD(allocations, 1);
+    S21_TRACK_ALLOCATED("vector", _capacity * sizeof(T));
     for (size_type i = 0; i < n; ++i) {
         _Vector_manager::construct(_a, _head + i);
     }
@@ -209,6 +222,7 @@ vector<T>::~vector() {
     clear();
 
     _Vector_manager::deallocate(_a, _head, _capacity);
+    S21_TRACK_RELEASED("vector", _capacity * sizeof(T));
 }
 
 template <typename T>
@@ -221,7 +235,10 @@ vector<T> &vector<T>::operator=(vector &&v) {
 
 template <typename T>
 void vector<T>::_reserve(size_type __capacity) {
-    T *__head = _Vector_manager::allocate(_a, __capacity + 1);
+    T *__head = _Vector_manager::allocate(_a, __capacity);
+    S21_STATS_ADD(allocations, 1);
+    S21_STATS_ADD(reallocations, 1);
+    S21_TRACK_ALLOCATED("vector", __capacity * sizeof(T));
     size_type __size = std::min(_size, __capacity);
 
     for (size_type i = 0; i < __size; ++i) {
@@ -233,6 +250,7 @@ void vector<T>::_reserve(size_type __capacity) {
     }
 
     _Vector_manager::deallocate(_a, _head, _capacity);
+    S21_TRACK_RELEASED("vector", _capacity * sizeof(T));
 
     _size = __size;
     _capacity = __capacity;
@@ -351,7 +369,7 @@ void vector<T>::clear() {
 
 template <typename T>
 typename vector<T>::iterator vector<T>::insert(iterator pos, const_reference value) {
-    if (_capacity == 0 || _size == _capacity - 1) {
+    if (_size + 1 >= _capacity) {
         _reserve((_capacity + _min_capacity) * 2);
     }
 
@@ -359,6 +377,7 @@ typename vector<T>::iterator vector<T>::insert(iterator pos, const_reference val
         std::swap(_head[i], _head[i - 1]);
     }
     _Vector_manager::construct(_a, _head + pos._offset, value);
+    S21_STATS_ADD(copies, 1);
 
     ++_size;
 
@@ -390,6 +409,15 @@ void vector<T>::push_back(const_reference value) {
     insert(end(), value);
 }
 
+template <typename T>
+void vector<T>::push_back(value_type &&value) {
+    if (_size + 1 >= _capacity) {
+        _reserve((_capacity + _min_capacity) * 2);
+    }
+    _Vector_manager::construct(_a, _head + _size, std::move(value));
+    ++_size;
+}
+
 template <typename T>
 template <typename... Args>
 void vector<T>::emplace_back(Args &&...args) {
@@ -409,6 +437,18 @@ void vector<T>::swap(vector &other) {
     std::swap(_capacity, other._capacity);
     std::swap(_head, other._head);
 }
+
+template <typename T>
+container_stats vector<T>::stats() const {
+    return S21_STATS_SNAPSHOT();
+}
+
+template <typename T>
+memory_footprint vector<T>::memory_usage() const {
+    memory_footprint usage = buffer_footprint(_size, _capacity, sizeof(T));
+    usage.metadata += sizeof(*this);
+    return usage;
+}
 }  // namespace s21
 
 #endif  // SRC_S21_VECTOR_H_